@@ -1,7 +1,11 @@
 #pragma once
 
 #include <cassert>
+#include <algorithm>
 #include <array>
+#include <cctype>
+#include <climits>
+#include <cstdlib>
 #include <limits>
 #include <cstdint>
 #include <string>
@@ -12,12 +16,43 @@
 #include <filesystem>
 #include <fstream>
 #include <regex>
+#ifdef _WIN32
 #include <Windows.h>
 #include <shlwapi.h>
 #include <XmlLite.h>
+#endif
 
 namespace cppwinrt
 {
+    inline std::string get_module_path()
+    {
+#ifdef _WIN32
+        std::string path(100, '?');
+        DWORD actual_size{};
+
+        while (true)
+        {
+            actual_size = GetModuleFileNameA(nullptr, path.data(), 1 + static_cast<uint32_t>(path.size()));
+
+            if (actual_size < 1 + path.size())
+            {
+                path.resize(actual_size);
+                break;
+            }
+            else
+            {
+                path.resize(path.size() * 2, '?');
+            }
+        }
+
+        return path;
+#else
+        std::error_code ec;
+        return std::filesystem::read_symlink("/proc/self/exe", ec).string();
+#endif
+    }
+
+#ifdef _WIN32
     struct registry_key
     {
         HKEY handle{};
@@ -178,29 +213,6 @@ namespace cppwinrt
         return root;
     }
 
-    inline std::string get_module_path()
-    {
-        std::string path(100, '?');
-        DWORD actual_size{};
-
-        while (true)
-        {
-            actual_size = GetModuleFileNameA(nullptr, path.data(), 1 + static_cast<uint32_t>(path.size()));
-
-            if (actual_size < 1 + path.size())
-            {
-                path.resize(actual_size);
-                break;
-            }
-            else
-            {
-                path.resize(path.size() * 2, '?');
-            }
-        }
-
-        return path;
-    }
-
     inline std::string get_sdk_version()
     {
         auto module_path = get_module_path();
@@ -279,6 +291,8 @@ namespace cppwinrt
         return result;
     }
 
+#endif
+
     [[noreturn]] inline void throw_invalid(std::string const& message)
     {
         throw std::invalid_argument(message);
@@ -425,6 +439,7 @@ namespace cppwinrt
                     files.insert(std::filesystem::canonical(path).string());
                     continue;
                 }
+#ifdef _WIN32
                 if (path == "local")
                 {
                     std::array<char, 260> local{};
@@ -479,6 +494,14 @@ namespace cppwinrt
 
                     continue;
                 }
+#else
+                // The local metadata folder and the Windows SDK are found through the Windows registry and
+                // environment, so other hosts must name winmd files and folders explicitly.
+                if (path == "local" || path == "sdk" || path == "sdk+" || std::regex_match(path, std::regex(R"((\d+)\.(\d+)\.(\d+)\.(\d+)\+?)")))
+                {
+                    throw_invalid("Spec '", path, "' is only supported on Windows");
+                }
+#endif
 
                 throw_invalid("Path '", path, "' is not a file or directory");
             }
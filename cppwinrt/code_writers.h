@@ -3259,7 +3259,9 @@ struct __declspec(empty_bases) produce_dispatch_to_overridable<T, D, %>
             w.write(strings::base_reference_produce);
             w.write(strings::base_deferral);
             w.write(strings::base_coroutine_foundation);
+            w.write(strings::base_coroutine_generator);
             w.write(strings::base_stringable_format);
+            w.write(strings::base_memory_buffer);
         }
         else if (namespace_name == "Windows.Foundation.Collections")
         {
@@ -3273,6 +3275,10 @@ struct __declspec(empty_bases) produce_dispatch_to_overridable<T, D, %>
             w.write(strings::base_collections_vector);
             w.write(strings::base_collections_map);
         }
+        else if (namespace_name == "Windows.Storage.Streams")
+        {
+            w.write(strings::base_buffer);
+        }
         else if (namespace_name == "Windows.System")
         {
             w.write(strings::base_coroutine_system);
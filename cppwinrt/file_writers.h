@@ -19,6 +19,7 @@ namespace cppwinrt
             w.write(strings::base_handle);
             w.write(strings::base_lock);
             w.write(strings::base_abi);
+            w.write(strings::base_portable);
             w.write(strings::base_windows);
             w.write(strings::base_com_ptr);
             w.write(strings::base_string);
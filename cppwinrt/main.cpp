@@ -1,5 +1,10 @@
 #include "pch.h"
 #include <ctime>
+#ifdef _WIN32
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
 #include "strings.h"
 #include "settings.h"
 #include "type_writers.h"
@@ -39,6 +44,7 @@ namespace cppwinrt
         { "fastabi", 0, 0 }, // Enable support for the Fast ABI
         { "ignore_velocity", 0, 0 }, // Ignore feature staging metadata and always include implementations
         { "synchronous", 0, 0 }, // Instructs cppwinrt to run on a single thread to avoid file system issues in batch builds
+        { "threads", 0, 1 }, // Limits the number of threads writing namespaces, for measuring parallel scaling
     };
 
     static void print_usage(writer& w)
@@ -77,6 +83,35 @@ Where <spec> is one or more of:
         w.write(format, CPPWINRT_VERSION_STRING, bind_each(printOption, options));
     }
 
+    static uint64_t get_peak_memory()
+    {
+#ifdef _WIN32
+        PROCESS_MEMORY_COUNTERS counters{};
+
+        if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        {
+            return 0;
+        }
+
+        return counters.PeakWorkingSetSize;
+#else
+        rusage usage{};
+
+        if (getrusage(RUSAGE_SELF, &usage) != 0)
+        {
+            return 0;
+        }
+
+        // Linux reports the peak resident set size in kilobytes.
+        return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+#endif
+    }
+
+    static void append_separator(std::string& folder)
+    {
+        folder += static_cast<char>(path::preferred_separator);
+    }
+
     static void process_args(reader const& args)
     {
         settings.verbose = args.exists("verbose");
@@ -94,7 +129,7 @@ Where <spec> is one or more of:
         path output_folder = args.value("output", ".");
         create_directories(output_folder / "winrt/impl");
         settings.output_folder = canonical(output_folder).string();
-        settings.output_folder += '\\';
+        append_separator(settings.output_folder);
 
         for (auto && include : args.values("include"))
         {
@@ -146,7 +181,7 @@ Where <spec> is one or more of:
             {
                 create_directories(component);
                 settings.component_folder = canonical(component).string();
-                settings.component_folder += '\\';
+                append_separator(settings.component_folder);
             }
         }
     }
@@ -251,6 +286,14 @@ Where <spec> is one or more of:
         try
         {
             auto start = get_start_time();
+            auto phase_start = start;
+            std::vector<std::tuple<std::string_view, int64_t, std::string_view>> phases;
+
+            auto end_phase = [&](std::string_view const& name, std::string_view const& note = {})
+            {
+                phases.emplace_back(name, get_elapsed_time(phase_start), note);
+                phase_start = get_start_time();
+            };
 
             reader args{ argc, argv, options };
 
@@ -260,17 +303,18 @@ Where <spec> is one or more of:
             }
 
             process_args(args);
+            end_phase("args");
             cache c{ get_files_to_cache(), [](TypeDef const& type) { return type.Flags().WindowsRuntime(); } };
+            end_phase("load");
             remove_foundation_types(c);
             build_filters(c);
             settings.base = settings.base || (!settings.component && settings.projection_filter.empty());
             build_fastabi_cache(c);
+            end_phase("filter");
 
             if (settings.verbose)
             {
-                char* path = nullptr;
-                _get_pgmptr(&path);
-                w.write(" tool:  %\n", path);
+                w.write(" tool:  %\n", get_module_path());
                 w.write(" ver:   %\n", CPPWINRT_VERSION_STRING);
 
                 for (auto&& file : settings.input)
@@ -294,12 +338,20 @@ Where <spec> is one or more of:
             w.flush_to_console();
             task_group group;
             group.synchronous(args.exists("synchronous"));
+            group.threads(static_cast<uint32_t>(std::stoul(args.value("threads", "0"))));
             writer ixx;
             write_preamble(ixx);
             ixx.write("module;\n");
             ixx.write(strings::base_includes);
             ixx.write("\nexport module winrt;\n#define WINRT_EXPORT export\n\n");
 
+            // The namespace tasks run alongside the base and component phases, so they time themselves: from the
+            // first one starting to the last one finishing, and summed across all of them.
+            auto const namespaces_start = get_start_time();
+            std::atomic<int64_t> namespaces_finished{};
+            std::atomic<int64_t> namespaces_summed{};
+            bool const overlapped = !args.exists("synchronous");
+
             for (auto&&[ns, members] : c.namespaces())
             {
                 if (!has_projected_types(members) || !settings.projection_filter.includes(members))
@@ -311,17 +363,31 @@ Where <spec> is one or more of:
 
                 group.add([&, &ns = ns, &members = members]
                 {
+                    auto const task_start = get_start_time();
                     write_namespace_0_h(ns, members);
                     write_namespace_1_h(ns, members);
                     write_namespace_2_h(ns, members);
                     write_namespace_h(c, ns, members);
+                    namespaces_summed += get_elapsed_time(task_start);
+
+                    auto const finished = get_elapsed_time(namespaces_start);
+                    auto latest = namespaces_finished.load();
+
+                    while (latest < finished && !namespaces_finished.compare_exchange_weak(latest, finished))
+                    {
+                    }
                 });
             }
 
+            // Unless -synchronous, the next two phases overlap with writing the namespaces.
+            std::string_view const overlap_note = overlapped ? " (overlaps namespaces)" : "";
+            phase_start = get_start_time();
+
             if (settings.base)
             {
                 write_base_h();
                 ixx.flush_to_file(settings.output_folder + "winrt/winrt.ixx");
+                end_phase("base", overlap_note);
             }
 
             if (settings.component)
@@ -354,10 +420,21 @@ Where <spec> is one or more of:
                 }
             }
 
+            end_phase("component", overlap_note);
             group.get();
+            phases.emplace_back("namespaces", namespaces_finished.load(), "");
+            phases.emplace_back("namespace_tasks", namespaces_summed.load(), " (summed over tasks)");
 
             if (settings.verbose)
             {
+                for (auto&& [name, time, note] : phases)
+                {
+                    w.write(" phase: % %ms%\n", name, time, note);
+                }
+
+                w.write(" files: % written, % unchanged\n", file_totals.written.load(), file_totals.skipped.load());
+                w.write(" bytes: %\n", file_totals.bytes.load());
+                w.write(" peak:  %KB\n", get_peak_memory() / 1024);
                 w.write(" time:  %ms\n", get_elapsed_time(start));
             }
         }
@@ -1,5 +1,10 @@
 #pragma once
 
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+
 namespace cppwinrt
 {
     struct task_group
@@ -22,6 +27,12 @@ namespace cppwinrt
             m_synchronous = synchronous;
         }
 
+        // Caps the number of threads running tasks. Zero, the default, lets each task run on its own.
+        void threads(uint32_t threads) noexcept
+        {
+            m_threads = threads;
+        }
+
         template <typename T>
         void add(T&& callback)
         {
@@ -29,10 +40,21 @@ namespace cppwinrt
             {
                 callback();
             }
-            else
+            else if (m_threads == 0)
             {
                 m_tasks.push_back(std::async(std::forward<T>(callback)));
             }
+            else
+            {
+                std::lock_guard const guard(m_lock);
+                m_queue.emplace_back(std::forward<T>(callback));
+
+                if (m_workers < m_threads)
+                {
+                    ++m_workers;
+                    m_tasks.push_back(std::async(std::launch::async, [this] { drain(); }));
+                }
+            }
         }
 
         void get()
@@ -52,7 +74,34 @@ namespace cppwinrt
 
     private:
 
+        void drain()
+        {
+            while (true)
+            {
+                std::function<void()> task;
+
+                {
+                    std::lock_guard const guard(m_lock);
+
+                    if (m_queue.empty())
+                    {
+                        --m_workers;
+                        return;
+                    }
+
+                    task = std::move(m_queue.front());
+                    m_queue.pop_front();
+                }
+
+                task();
+            }
+        }
+
         std::vector<std::future<void>> m_tasks;
+        std::mutex m_lock;
+        std::deque<std::function<void()>> m_queue;
+        uint32_t m_threads{};
+        uint32_t m_workers{};
         bool m_synchronous{};
     };
 }
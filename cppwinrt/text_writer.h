@@ -1,11 +1,15 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <cstdio>
 #include <filesystem>
 #include <fstream>
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <vector>
 
 namespace cppwinrt
 {
@@ -15,6 +19,16 @@ namespace cppwinrt
         return static_cast<std::stringstream const&>(std::stringstream() << file.rdbuf()).str();
     }
 
+    // Totals across all writers, reported by -verbose. Files whose content is unchanged are skipped, not written.
+    struct file_statistics
+    {
+        std::atomic<uint64_t> written{};
+        std::atomic<uint64_t> skipped{};
+        std::atomic<uint64_t> bytes{};
+    };
+
+    inline file_statistics file_totals;
+
     template <typename T>
     struct writer_base
     {
@@ -127,8 +141,8 @@ namespace cppwinrt
         void write_printf(char const* format, Args const&... args)
         {
             char buffer[128];
-            size_t const size = sprintf_s(buffer, format, args...);
-            write(std::string_view{ buffer, size });
+            int const size = snprintf(buffer, sizeof(buffer), format, args...);
+            write(std::string_view{ buffer, std::min(static_cast<size_t>(std::max(size, 0)), sizeof(buffer) - 1) });
         }
 
         template <auto F, typename List, typename... Args>
@@ -169,6 +183,13 @@ namespace cppwinrt
                 {
                   throw std::filesystem::filesystem_error(e.what(), filename, std::io_errc::stream);
                 }
+
+                file_totals.written.fetch_add(1, std::memory_order_relaxed);
+                file_totals.bytes.fetch_add(m_first.size() + m_second.size(), std::memory_order_relaxed);
+            }
+            else
+            {
+                file_totals.skipped.fetch_add(1, std::memory_order_relaxed);
             }
             m_first.clear();
             m_second.clear();
@@ -0,0 +1,13 @@
+@echo off
+setlocal
+
+set target_platform=%1
+set target_configuration=%2
+set target_output=%3
+
+if "%target_platform%"=="" set target_platform=x64
+if "%target_configuration%"=="" set target_configuration=Release
+if "%target_output%"=="" set target_output=benchmark_results.json
+
+rem Benchmarks are only meaningful in optimized builds. Compare the JSON output of two commits by benchmark name.
+_build\%target_platform%\%target_configuration%\benchmark.exe -r json -o %target_output%
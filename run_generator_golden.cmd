@@ -0,0 +1,15 @@
+@echo off
+setlocal
+
+set target_platform=%1
+set target_configuration=%2
+
+if "%target_platform%"=="" set target_platform=x64
+if "%target_configuration%"=="" set target_configuration=Debug
+
+set build_output=_build\%target_platform%\%target_configuration%
+
+rem Compares the projection of test_component with the checked-in golden. Pass -update to create the golden or accept the current output.
+rem Not yet called from build_test_all.cmd: run once with -update on Windows and check in test\generator_golden\golden.txt first.
+rem Buffer output and redirect to stdout/stderr depending whether the comparison succeeds. Pipeline will fail if there's any output to stderr.
+%build_output%\generator_golden.exe -cppwinrt %build_output%\cppwinrt.exe -golden test\generator_golden\golden.txt -output %build_output%\generator_golden %3 -- -input %build_output%\test_component.winmd -include test_component -ref sdk -comp -prefix -opt -lib test -fastabi -name test_component > generator_golden_results.txt && type generator_golden_results.txt || type generator_golden_results.txt >&2
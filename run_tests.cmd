@@ -10,6 +10,9 @@ if "%target_configuration%"=="" set target_configuration=Debug
 
 call :run_test test
 call :run_test test_cpp20
+call :run_test test_allocations
+call :run_test test_options
+call :run_test test_portable
 call :run_test test_win7
 call :run_test test_fast
 call :run_test test_slow
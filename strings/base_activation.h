@@ -18,10 +18,67 @@ namespace winrt::impl
 
     using library_handle = handle_type<library_traits>;
 
-    inline int32_t __stdcall fallback_RoGetActivationFactory(void*, guid const&, void** factory) noexcept
+#ifdef WINRT_PORTABLE
+    // Stands in for the activation catalog. Classes are only found if registered with register_activation_factory.
+    struct portable_activation_registry
     {
+        int32_t get(void* classId, guid const& iid, void** factory) noexcept
+        {
+            *factory = nullptr;
+            slim_shared_lock_guard const guard(m_lock);
+            auto found = m_factories.find(*reinterpret_cast<hstring const*>(&classId));
+
+            if (found == m_factories.end())
+            {
+                return error_class_not_registered;
+            }
+
+            return found->second.as(iid, factory);
+        }
+
+        void add(hstring const& name, com_ptr<unknown_abi> factory)
+        {
+            slim_lock_guard const guard(m_lock);
+            m_factories.insert_or_assign(name, std::move(factory));
+        }
+
+        bool remove(hstring const& name) noexcept
+        {
+            com_ptr<unknown_abi> factory;
+            slim_lock_guard const guard(m_lock);
+            auto found = m_factories.find(name);
+
+            if (found == m_factories.end())
+            {
+                return false;
+            }
+
+            factory = std::move(found->second);
+            m_factories.erase(found);
+            return true;
+        }
+
+    private:
+
+        slim_mutex m_lock;
+        std::map<hstring, com_ptr<unknown_abi>> m_factories;
+    };
+
+    inline portable_activation_registry& get_portable_activation_registry() noexcept
+    {
+        static portable_activation_registry registry;
+        return registry;
+    }
+#endif
+
+    inline int32_t __stdcall fallback_RoGetActivationFactory([[maybe_unused]] void* classId, [[maybe_unused]] guid const& iid, void** factory) noexcept
+    {
+#ifdef WINRT_PORTABLE
+        return get_portable_activation_registry().get(classId, iid, factory);
+#else
         *factory = nullptr;
         return error_class_not_available;
+#endif
     }
 
 
@@ -146,6 +203,8 @@ namespace winrt::impl
         int32_t const result = __iso_volatile_load32(reinterpret_cast<int32_t const volatile*>(target));
         WINRT_IMPL_INTERLOCKED_READ_MEMORY_BARRIER
         return result;
+#elif !defined _WIN32
+        return __atomic_load_n(target, __ATOMIC_ACQUIRE);
 #else
 #error Unsupported architecture
 #endif
@@ -177,17 +236,31 @@ namespace winrt::impl
     template <typename T>
     T* interlocked_read_pointer(T* const volatile* target) noexcept
     {
-#ifdef _WIN64
+#if !defined _WIN32
+        return __atomic_load_n(target, __ATOMIC_ACQUIRE);
+#elif defined _WIN64
         return (T*)interlocked_read_64((int64_t*)target);
 #else
         return (T*)interlocked_read_32((int32_t*)target);
 #endif
     }
 
+    inline void* interlocked_compare_exchange_pointer(void** target, void* exchange, void* comparand) noexcept
+    {
+#if !defined _WIN32
+        __atomic_compare_exchange_n(target, &comparand, exchange, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+        return comparand;
+#else
+        return _InterlockedCompareExchangePointer(target, exchange, comparand);
+#endif
+    }
+
 #ifdef _WIN64
     inline constexpr uint32_t memory_allocation_alignment{ 16 };
+#ifdef _MSC_VER
 #pragma warning(push)
 #pragma warning(disable:4324) // structure was padded due to alignment specifier
+#endif
     struct alignas(16) slist_entry
     {
         slist_entry* next;
@@ -207,7 +280,9 @@ namespace winrt::impl
             uint64_t reserved4 : 60;
         } reserved2;
     };
+#ifdef _MSC_VER
 #pragma warning(pop)
+#endif
 #else
     inline constexpr uint32_t memory_allocation_alignment{ 8 };
     struct slist_entry
@@ -234,7 +309,9 @@ namespace winrt::impl
         explicit factory_count_guard(size_t& count) noexcept : m_count(count)
         {
 #ifndef WINRT_NO_MODULE_LOCK
-#ifdef _WIN64
+#if !defined _WIN32
+            __atomic_add_fetch(&m_count, 1, __ATOMIC_SEQ_CST);
+#elif defined _WIN64
             _InterlockedIncrement64((int64_t*)&m_count);
 #else
             _InterlockedIncrement((long*)&m_count);
@@ -245,7 +322,9 @@ namespace winrt::impl
         ~factory_count_guard() noexcept
         {
 #ifndef WINRT_NO_MODULE_LOCK
-#ifdef _WIN64
+#if !defined _WIN32
+            __atomic_sub_fetch(&m_count, 1, __ATOMIC_SEQ_CST);
+#elif defined _WIN64
             _InterlockedDecrement64((int64_t*)&m_count);
 #else
             _InterlockedDecrement((long*)&m_count);
@@ -280,7 +359,15 @@ namespace winrt::impl
 
             object_and_count current_value{ pointer_value, 0 };
 
-#if defined _WIN64
+#if !defined _WIN32
+            // On 64-bit targets this compare-exchange may need libatomic.
+            object_and_count cleared{};
+
+            if (__atomic_compare_exchange(&m_value, &current_value, &cleared, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+            {
+                pointer_value->Release();
+            }
+#elif defined _WIN64
             if (1 == _InterlockedCompareExchange128((int64_t*)this, 0, 0, (int64_t*)&current_value))
             {
                 pointer_value->Release();
@@ -298,7 +385,7 @@ namespace winrt::impl
 
     static_assert(std::is_standard_layout_v<factory_cache_entry_base>);
 
-#if !defined _M_IX86 && !defined _M_X64 && !defined _M_ARM && !defined _M_ARM64
+#if !defined WINRT_PORTABLE && !defined _M_IX86 && !defined _M_X64 && !defined _M_ARM && !defined _M_ARM64
 #error Unsupported architecture: verify that zero-initialization of SLIST_HEADER is still safe
 #endif
 
@@ -363,7 +450,7 @@ namespace winrt::impl
             {
                 factory_count_guard const guard(m_value.count);
 
-                if (nullptr == _InterlockedCompareExchangePointer(reinterpret_cast<void**>(&m_value.object), *reinterpret_cast<void**>(&object), nullptr))
+                if (nullptr == interlocked_compare_exchange_pointer(reinterpret_cast<void**>(&m_value.object), *reinterpret_cast<void**>(&object), nullptr))
                 {
                     *reinterpret_cast<void**>(&object) = nullptr;
 #ifndef WINRT_NO_MODULE_LOCK
@@ -539,6 +626,23 @@ WINRT_EXPORT namespace winrt
             }
         };
     }
+
+#ifdef WINRT_PORTABLE
+    inline void register_activation_factory(param::hstring const& name, Windows::Foundation::IActivationFactory const& factory)
+    {
+        com_ptr<impl::unknown_abi> value;
+        value.copy_from(static_cast<impl::unknown_abi*>(get_abi(factory)));
+        impl::get_portable_activation_registry().add(name, std::move(value));
+    }
+
+    // Also clears the factory cache, since agile factories are cached by the first activation.
+    inline bool unregister_activation_factory(param::hstring const& name) noexcept
+    {
+        bool const removed = impl::get_portable_activation_registry().remove(name);
+        clear_factory_cache();
+        return removed;
+    }
+#endif
 }
 
 namespace winrt::impl
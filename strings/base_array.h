@@ -222,6 +222,176 @@ WINRT_EXPORT namespace winrt
     template <typename C> array_view(std::vector<C> const& value) -> array_view<C const>;
     template <typename C, size_t N> array_view(std::array<C, N>& value) -> array_view<C>;
     template <typename C, size_t N> array_view(std::array<C, N> const& value) -> array_view<C const>;
+}
+
+namespace winrt::impl
+{
+    // Keeps blocks released by com_array in power-of-two size classes and hands them out again instead
+    // of returning them to the COM heap. The blocks always come from CoTaskMemAlloc, so arrays remain
+    // free to cross the ABI in either direction and be released by whoever ends up owning them.
+    struct array_pool
+    {
+        void* allocate(size_t const bytes) noexcept
+        {
+            if (bytes >= min_size && bytes < max_size)
+            {
+                uint32_t const index = size_class(bytes);
+                slim_lock_guard const guard(m_lock);
+
+                // A block from the next class up is always big enough.
+                if (auto block = take(index, bytes); block || (block = take(index + 1, bytes)))
+                {
+                    return block;
+                }
+            }
+
+            return WINRT_IMPL_CoTaskMemAlloc(bytes);
+        }
+
+        void deallocate(void* const block, size_t const bytes) noexcept
+        {
+            // The block may be bigger than bytes, for example if another component allocated it,
+            // but only bytes can be relied on.
+            if (bytes >= min_size && bytes < max_size)
+            {
+                uint32_t const index = size_class(bytes);
+                slim_lock_guard const guard(m_lock);
+
+                if (!m_drained && m_counts[index] < depth)
+                {
+                    m_blocks[index] = new (block) free_block{ m_blocks[index], bytes };
+                    ++m_counts[index];
+                    return;
+                }
+            }
+
+            WINRT_IMPL_CoTaskMemFree(block);
+        }
+
+        void trim() noexcept
+        {
+            free_block* blocks[class_count];
+
+            {
+                slim_lock_guard const guard(m_lock);
+                std::copy(std::begin(m_blocks), std::end(m_blocks), blocks);
+                std::fill(std::begin(m_blocks), std::end(m_blocks), nullptr);
+                std::fill(std::begin(m_counts), std::end(m_counts), 0);
+            }
+
+            for (auto block : blocks)
+            {
+                while (block)
+                {
+                    WINRT_IMPL_CoTaskMemFree(std::exchange(block, block->next));
+                }
+            }
+        }
+
+        // Frees the pooled blocks for good. Blocks released afterwards go straight back to the COM heap.
+        void drain() noexcept
+        {
+            {
+                slim_lock_guard const guard(m_lock);
+                m_drained = true;
+            }
+
+            trim();
+        }
+
+    private:
+
+        static constexpr uint32_t min_class{ 4 };
+        static constexpr uint32_t class_count{ 13 };
+        static constexpr size_t min_size{ size_t{ 1 } << min_class }; // 16 bytes
+        static constexpr size_t max_size{ min_size << class_count }; // 128 KB
+        static constexpr uint32_t depth{ 16 };
+
+        struct free_block
+        {
+            free_block* next;
+            size_t bytes;
+        };
+
+        static uint32_t size_class(size_t const bytes) noexcept
+        {
+            uint32_t index{};
+
+            while ((min_size << (index + 1)) <= bytes)
+            {
+                ++index;
+            }
+
+            return index;
+        }
+
+        void* take(uint32_t const index, size_t const bytes) noexcept
+        {
+            if (index == class_count)
+            {
+                return nullptr;
+            }
+
+            for (free_block** link = &m_blocks[index]; *link; link = &(*link)->next)
+            {
+                if ((*link)->bytes >= bytes)
+                {
+                    free_block* const block = *link;
+                    *link = block->next;
+                    --m_counts[index];
+                    return block;
+                }
+            }
+
+            return nullptr;
+        }
+
+        slim_mutex m_lock;
+        free_block* m_blocks[class_count]{};
+        uint32_t m_counts[class_count]{};
+        bool m_drained{};
+    };
+
+#ifdef WINRT_POOLED_ARRAYS
+    // Constant-initialized and never destroyed, so arrays may be released during static destruction.
+    inline array_pool pooled_arrays;
+
+    // Returns the pooled blocks to the COM heap when the module unloads, or the process exits, rather than leaking
+    // them. Arrays released by later static destructors bypass the pool.
+    struct array_pool_drain
+    {
+        ~array_pool_drain()
+        {
+            pooled_arrays.drain();
+        }
+    };
+
+    inline array_pool_drain drain_pooled_arrays;
+
+    inline void* array_allocate(size_t const bytes) noexcept
+    {
+        return pooled_arrays.allocate(bytes);
+    }
+
+    inline void array_deallocate(void* const block, size_t const bytes) noexcept
+    {
+        pooled_arrays.deallocate(block, bytes);
+    }
+#else
+    inline void* array_allocate(size_t const bytes) noexcept
+    {
+        return WINRT_IMPL_CoTaskMemAlloc(bytes);
+    }
+
+    inline void array_deallocate(void* const block, size_t) noexcept
+    {
+        WINRT_IMPL_CoTaskMemFree(block);
+    }
+#endif
+}
+
+WINRT_EXPORT namespace winrt
+{
 
     template <typename T>
     struct com_array : array_view<T>
@@ -261,17 +431,45 @@ WINRT_EXPORT namespace winrt
         com_array(InIt first, InIt last)
         {
             alloc(static_cast<size_type>(std::distance(first, last)));
-            std::uninitialized_copy(first, last, this->begin());
+            copy_construct(first, last);
         }
 
         template <typename U>
-        explicit com_array(std::vector<U> const& value) :
-            com_array(value.begin(), value.end())
-        {}
+        explicit com_array(std::vector<U> const& value)
+        {
+            alloc(static_cast<size_type>(value.size()));
+
+            if constexpr (std::is_same_v<U, bool>)
+            {
+                std::uninitialized_copy(value.begin(), value.end(), this->begin());
+            }
+            else
+            {
+                copy_construct(value.data(), value.data() + value.size());
+            }
+        }
+
+        explicit com_array(std::vector<value_type>&& value)
+        {
+            alloc(static_cast<size_type>(value.size()));
+
+            if constexpr (std::is_same_v<value_type, bool>)
+            {
+                std::uninitialized_copy(value.begin(), value.end(), this->begin());
+            }
+            else if constexpr (std::is_trivially_copyable_v<value_type>)
+            {
+                copy_construct(value.data(), value.data() + value.size());
+            }
+            else
+            {
+                std::uninitialized_move(value.begin(), value.end(), this->begin());
+            }
+        }
 
         template <typename U, size_t N>
         explicit com_array(std::array<U, N> const& value) :
-            com_array(value.begin(), value.end())
+            com_array(value.data(), value.data() + N)
         {}
 
         template <typename U, size_t N>
@@ -289,10 +487,12 @@ WINRT_EXPORT namespace winrt
         {}
 
         com_array(com_array&& other) noexcept :
-            array_view<T>(other.m_data, other.m_size)
+            array_view<T>(other.m_data, other.m_size),
+            m_capacity(other.m_capacity)
         {
             other.m_data = nullptr;
             other.m_size = 0;
+            other.m_capacity = 0;
         }
 
         com_array& operator=(com_array&& other) noexcept
@@ -300,8 +500,10 @@ WINRT_EXPORT namespace winrt
             clear();
             this->m_data = other.m_data;
             this->m_size = other.m_size;
+            m_capacity = other.m_capacity;
             other.m_data = nullptr;
             other.m_size = 0;
+            other.m_capacity = 0;
             return*this;
         }
 
@@ -316,26 +518,74 @@ WINRT_EXPORT namespace winrt
 
             std::destroy(this->begin(), this->end());
 
-            WINRT_IMPL_CoTaskMemFree(this->m_data);
+            impl::array_deallocate(this->m_data, capacity() * sizeof(value_type));
             this->m_data = nullptr;
             this->m_size = 0;
+            m_capacity = 0;
+        }
+
+        // Replaces the contents with count value-initialized elements, reusing the current buffer, such as
+        // one received from a previous call, when it's already big enough. The buffer keeps its full size
+        // when the array shrinks, so later calls may grow the array back within it.
+        void reset_with_capacity(size_type const count)
+        {
+            if (count == 0 || count > capacity())
+            {
+                clear();
+                alloc(count);
+            }
+            else
+            {
+                std::destroy(this->begin(), this->end());
+                m_capacity = capacity();
+                this->m_size = count;
+            }
+
+            std::uninitialized_value_construct_n(this->m_data, this->m_size);
         }
 
         friend void swap(com_array& left, com_array& right) noexcept
         {
             std::swap(left.m_data, right.m_data);
             std::swap(left.m_size, right.m_size);
+            std::swap(left.m_capacity, right.m_capacity);
         }
 
     private:
 
+        template <typename U>
+        friend struct com_array_builder;
+
+        // The number of elements the buffer holds, which is only tracked once it exceeds the size of the array.
+        // A buffer received from the ABI holds exactly size() elements.
+        size_type capacity() const noexcept
+        {
+            return (std::max)(m_capacity, this->m_size);
+        }
+
+        template <typename InIt>
+        void copy_construct(InIt first, InIt last)
+        {
+            if constexpr (std::is_pointer_v<InIt> && std::is_same_v<std::remove_cv_t<std::remove_pointer_t<InIt>>, value_type> && std::is_trivially_copyable_v<value_type>)
+            {
+                if (first != last)
+                {
+                    memcpy(this->m_data, first, (last - first) * sizeof(value_type));
+                }
+            }
+            else
+            {
+                std::uninitialized_copy(first, last, this->begin());
+            }
+        }
+
         void alloc(size_type const size)
         {
             WINRT_ASSERT(this->empty());
 
             if (0 != size)
             {
-                this->m_data = static_cast<value_type*>(WINRT_IMPL_CoTaskMemAlloc(size * sizeof(value_type)));
+                this->m_data = static_cast<value_type*>(impl::array_allocate(size * sizeof(value_type)));
 
                 if (this->m_data == nullptr)
                 {
@@ -345,6 +595,8 @@ WINRT_EXPORT namespace winrt
                 this->m_size = size;
             }
         }
+
+        size_type m_capacity{};
     };
 
     template <typename C> com_array(uint32_t, C const&) -> com_array<std::decay_t<C>>;
@@ -355,6 +607,163 @@ WINRT_EXPORT namespace winrt
     template <size_t N, typename C> com_array(C const(&)[N]) -> com_array<std::decay_t<C>>;
     template <typename C> com_array(std::initializer_list<C>) -> com_array<std::decay_t<C>>;
 
+    template <typename T>
+    struct com_array_builder
+    {
+        using value_type = T;
+        using size_type = uint32_t;
+
+        com_array_builder(com_array_builder const&) = delete;
+        com_array_builder& operator=(com_array_builder const&) = delete;
+
+        com_array_builder() noexcept = default;
+
+        explicit com_array_builder(size_type const capacity)
+        {
+            reserve(capacity);
+        }
+
+        com_array_builder(com_array_builder&& other) noexcept :
+            m_data(std::exchange(other.m_data, nullptr)),
+            m_size(std::exchange(other.m_size, 0)),
+            m_capacity(std::exchange(other.m_capacity, 0))
+        {
+        }
+
+        com_array_builder& operator=(com_array_builder&& other) noexcept
+        {
+            if (this != &other)
+            {
+                clear();
+                m_data = std::exchange(other.m_data, nullptr);
+                m_size = std::exchange(other.m_size, 0);
+                m_capacity = std::exchange(other.m_capacity, 0);
+            }
+
+            return *this;
+        }
+
+        ~com_array_builder() noexcept
+        {
+            clear();
+        }
+
+        value_type* data() noexcept { return m_data; }
+        value_type const* data() const noexcept { return m_data; }
+        size_type size() const noexcept { return m_size; }
+        size_type capacity() const noexcept { return m_capacity; }
+        bool empty() const noexcept { return m_size == 0; }
+
+        value_type& operator[](size_type const pos) noexcept
+        {
+            WINRT_ASSERT(pos < m_size);
+            return m_data[pos];
+        }
+
+        value_type const& operator[](size_type const pos) const noexcept
+        {
+            WINRT_ASSERT(pos < m_size);
+            return m_data[pos];
+        }
+
+        void reserve(size_type const capacity)
+        {
+            if (capacity > m_capacity)
+            {
+                reallocate(capacity);
+            }
+        }
+
+        template <typename... Args>
+        value_type& emplace_back(Args&&... args)
+        {
+            if (m_size < m_capacity)
+            {
+                new (m_data + m_size) value_type(std::forward<Args>(args)...);
+            }
+            else
+            {
+                // The arguments may refer to an element that is about to move.
+                value_type value(std::forward<Args>(args)...);
+                reallocate(m_capacity < 4 ? 8 : m_capacity * 2);
+                new (m_data + m_size) value_type(std::move(value));
+            }
+
+            return m_data[m_size++];
+        }
+
+        void push_back(value_type const& value)
+        {
+            emplace_back(value);
+        }
+
+        void push_back(value_type&& value)
+        {
+            emplace_back(std::move(value));
+        }
+
+        void clear() noexcept
+        {
+            if (m_data)
+            {
+                std::destroy(m_data, m_data + m_size);
+                impl::array_deallocate(m_data, m_capacity * sizeof(value_type));
+                m_data = nullptr;
+                m_size = 0;
+                m_capacity = 0;
+            }
+        }
+
+        // Hands the buffer over to a com_array without copying, along with any spare capacity.
+        com_array<value_type> finish() noexcept
+        {
+            if (m_size == 0)
+            {
+                clear();
+                return {};
+            }
+
+            com_array<value_type> result{ std::exchange(m_data, nullptr), std::exchange(m_size, 0), take_ownership_from_abi };
+            result.m_capacity = std::exchange(m_capacity, 0);
+            return result;
+        }
+
+    private:
+
+        void reallocate(size_type const capacity)
+        {
+            WINRT_ASSERT(capacity >= m_size);
+            auto data = static_cast<value_type*>(impl::array_allocate(capacity * sizeof(value_type)));
+
+            if (data == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+
+            if (m_data)
+            {
+                if constexpr (std::is_trivially_copyable_v<value_type>)
+                {
+                    memcpy(data, m_data, m_size * sizeof(value_type));
+                }
+                else
+                {
+                    std::uninitialized_move(m_data, m_data + m_size, data);
+                    std::destroy(m_data, m_data + m_size);
+                }
+
+                impl::array_deallocate(m_data, m_capacity * sizeof(value_type));
+            }
+
+            m_data = data;
+            m_capacity = capacity;
+        }
+
+        value_type* m_data{};
+        size_type m_size{};
+        size_type m_capacity{};
+    };
+
     namespace impl
     {
         template <typename T, typename U>
@@ -399,6 +808,36 @@ WINRT_EXPORT namespace winrt
         }
     }
 
+    // Reinterprets a range of objects as borrowed references, so that the elements may be copied out and passed
+    // around without reference counting.
+    template <typename T, std::enable_if_t<impl::is_borrowable_v<T>, int> = 0>
+    array_view<borrowed<T> const> borrow(array_view<T const> values) noexcept
+    {
+        static_assert(sizeof(borrowed<T>) == sizeof(T));
+        return { reinterpret_cast<borrowed<T> const*>(values.data()), values.size() };
+    }
+
+    template <typename T, std::enable_if_t<impl::is_borrowable_v<T>, int> = 0>
+    array_view<borrowed<T> const> borrow(std::vector<T> const& values) noexcept
+    {
+        return borrow(array_view<T const>(values));
+    }
+
+    // The inverse of borrow, for handing a range of borrowed references to an API that accepts array_view<T const>,
+    // such as IVector<T>::ReplaceAll.
+    template <typename T>
+    array_view<T const> unborrow(array_view<borrowed<T> const> values) noexcept
+    {
+        static_assert(sizeof(borrowed<T>) == sizeof(T));
+        return { reinterpret_cast<T const*>(values.data()), values.size() };
+    }
+
+    template <typename T>
+    array_view<T const> unborrow(std::vector<borrowed<T>> const& values) noexcept
+    {
+        return unborrow(array_view<borrowed<T> const>(values));
+    }
+
     template <typename T>
     auto put_abi(array_view<T> object) noexcept
     {
@@ -0,0 +1,213 @@
+
+namespace winrt::impl
+{
+    template <typename D>
+    struct buffer_byte_access final : IBufferByteAccess
+    {
+        explicit buffer_byte_access(D* outer) noexcept : m_outer(outer)
+        {
+        }
+
+        int32_t __stdcall QueryInterface(guid const& id, void** object) noexcept final
+        {
+            return outer()->QueryInterface(id, object);
+        }
+
+        uint32_t __stdcall AddRef() noexcept final
+        {
+            return outer()->AddRef();
+        }
+
+        uint32_t __stdcall Release() noexcept final
+        {
+            return outer()->Release();
+        }
+
+        int32_t __stdcall Buffer(uint8_t** value) noexcept final
+        {
+            *value = m_outer->data();
+            return 0;
+        }
+
+    private:
+
+        unknown_abi* outer() const noexcept
+        {
+            return static_cast<unknown_abi*>(m_outer->template get_abi<Windows::Storage::Streams::IBuffer>());
+        }
+
+        D* m_outer;
+    };
+
+    struct buffer_memory
+    {
+        buffer_memory(buffer_memory const&) = delete;
+        buffer_memory& operator=(buffer_memory const&) = delete;
+
+        explicit buffer_memory(uint32_t const capacity) : m_capacity(capacity)
+        {
+            if (capacity)
+            {
+                m_data = static_cast<uint8_t*>(array_allocate(capacity));
+
+                if (!m_data)
+                {
+                    throw std::bad_alloc();
+                }
+            }
+        }
+
+        buffer_memory(buffer_memory&& other) noexcept :
+            m_data(std::exchange(other.m_data, nullptr)),
+            m_capacity(std::exchange(other.m_capacity, 0))
+        {
+        }
+
+        ~buffer_memory() noexcept
+        {
+            if (m_data)
+            {
+                array_deallocate(m_data, m_capacity);
+            }
+        }
+
+        uint8_t* data() const noexcept
+        {
+            return m_data;
+        }
+
+    private:
+
+        uint8_t* m_data{};
+        uint32_t m_capacity{};
+    };
+
+    template <typename Owner>
+    struct local_buffer : implements<local_buffer<Owner>, Windows::Storage::Streams::IBuffer>
+    {
+        local_buffer(uint8_t* data, uint32_t const capacity, uint32_t const length, Owner&& owner) :
+            m_owner(std::move(owner)),
+            m_data(data),
+            m_capacity(capacity),
+            m_length(length)
+        {
+        }
+
+        uint32_t Capacity() const noexcept
+        {
+            return m_capacity;
+        }
+
+        uint32_t Length() const noexcept
+        {
+            return m_length.load(std::memory_order_relaxed);
+        }
+
+        void Length(uint32_t const value)
+        {
+            if (value > m_capacity)
+            {
+                throw hresult_invalid_argument();
+            }
+
+            m_length.store(value, std::memory_order_relaxed);
+        }
+
+        uint8_t* data() const noexcept
+        {
+            return m_data;
+        }
+
+        int32_t query_interface_tearoff(guid const& id, void** object) const noexcept final
+        {
+            if (is_guid_of<IBufferByteAccess>(id))
+            {
+                *object = static_cast<IBufferByteAccess*>(&m_byte_access);
+                m_byte_access.AddRef();
+                return 0;
+            }
+
+            *object = nullptr;
+            return error_no_interface;
+        }
+
+    private:
+
+        Owner m_owner;
+        uint8_t* const m_data;
+        uint32_t const m_capacity;
+        std::atomic<uint32_t> m_length;
+        mutable buffer_byte_access<local_buffer> m_byte_access{ this };
+    };
+}
+
+WINRT_EXPORT namespace winrt
+{
+    inline array_view<uint8_t> data_span(Windows::Storage::Streams::IBuffer const& buffer)
+    {
+        uint8_t* data{};
+        check_hresult(buffer.as<impl::IBufferByteAccess>()->Buffer(&data));
+        return { data, buffer.Length() };
+    }
+
+    // Holds on to a buffer's bytes so that repeated access doesn't need to query for IBufferByteAccess.
+    // The pointer is stable for the lifetime of the buffer, so only the length is read on each call.
+    struct buffer_access
+    {
+        buffer_access() noexcept = default;
+
+        explicit buffer_access(Windows::Storage::Streams::IBuffer const& buffer) : m_buffer(buffer)
+        {
+            if (m_buffer)
+            {
+                check_hresult(m_buffer.as<impl::IBufferByteAccess>()->Buffer(&m_data));
+            }
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return static_cast<bool>(m_buffer);
+        }
+
+        Windows::Storage::Streams::IBuffer const& buffer() const noexcept
+        {
+            return m_buffer;
+        }
+
+        uint8_t* data() const noexcept
+        {
+            return m_data;
+        }
+
+        array_view<uint8_t> span() const
+        {
+            return { m_data, m_buffer.Length() };
+        }
+
+        array_view<uint8_t> capacity_span() const
+        {
+            return { m_data, m_buffer.Capacity() };
+        }
+
+    private:
+
+        Windows::Storage::Streams::IBuffer m_buffer;
+        uint8_t* m_data{};
+    };
+
+    // Returns an empty buffer over CoTaskMem memory, drawn from the array pool when WINRT_POOLED_ARRAYS is defined.
+    inline Windows::Storage::Streams::IBuffer make_buffer(uint32_t const capacity)
+    {
+        impl::buffer_memory memory(capacity);
+        auto const data = memory.data();
+        return make<impl::local_buffer<impl::buffer_memory>>(data, capacity, 0, std::move(memory));
+    }
+
+    // Returns a full buffer over caller-owned memory. The owner, such as a std::vector or a std::shared_ptr,
+    // is kept alive for as long as the buffer. Without an owner the caller must keep the memory alive.
+    template <typename Owner = std::nullptr_t>
+    Windows::Storage::Streams::IBuffer make_buffer(array_view<uint8_t> memory, Owner owner = nullptr)
+    {
+        return make<impl::local_buffer<Owner>>(memory.data(), memory.size(), memory.size(), std::move(owner));
+    }
+}
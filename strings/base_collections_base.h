@@ -13,23 +13,39 @@ namespace winrt::impl
         {
             return nop_lock_guard();
         }
+
+#ifdef WINRT_LOCK_DIAGNOSTICS
+        template <typename Owner>
+        void name_lock() noexcept
+        {
+        }
+#endif
     };
 
+    template <typename Lock = slim_mutex>
     struct multi_threaded_collection_base
     {
         [[nodiscard]] auto acquire_exclusive() const
         {
-            return slim_lock_guard{m_mutex};
+            return lock_guard{m_mutex};
         }
 
         [[nodiscard]] auto acquire_shared() const
         {
-            return slim_shared_lock_guard{m_mutex};
+            return shared_lock_guard{m_mutex};
+        }
+
+#ifdef WINRT_LOCK_DIAGNOSTICS
+        template <typename Owner>
+        void name_lock()
+        {
+            impl::name_lock<Owner>(m_mutex);
         }
+#endif
 
     private:
 
-        mutable slim_mutex m_mutex;
+        mutable Lock m_mutex;
     };
 
     template <typename D>
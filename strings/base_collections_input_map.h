@@ -11,6 +11,9 @@ namespace winrt::impl
 
         explicit map_impl(Container&& values) : m_values(std::forward<Container>(values))
         {
+#ifdef WINRT_LOCK_DIAGNOSTICS
+            this->template name_lock<wfc::IMap<K, V>>();
+#endif
         }
 
         auto& get_container() noexcept
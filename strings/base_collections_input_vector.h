@@ -11,6 +11,9 @@ namespace winrt::impl
 
         explicit vector_impl(Container&& values) : m_values(std::forward<Container>(values))
         {
+#ifdef WINRT_LOCK_DIAGNOSTICS
+            this->template name_lock<wfc::IVector<T>>();
+#endif
         }
 
         auto& get_container() noexcept
@@ -1,8 +1,8 @@
 
 namespace winrt::impl
 {
-    template <typename K, typename V, typename Container>
-    using multi_threaded_map = map_impl<K, V, Container, multi_threaded_collection_base>;
+    template <typename K, typename V, typename Container, typename Lock = slim_mutex>
+    using multi_threaded_map = map_impl<K, V, Container, multi_threaded_collection_base<Lock>>;
 
     template <typename K, typename V, typename Container, typename ThreadingBase>
     struct observable_map_impl :
@@ -14,6 +14,9 @@ namespace winrt::impl
 
         explicit observable_map_impl(Container&& values) : m_values(std::forward<Container>(values))
         {
+#ifdef WINRT_LOCK_DIAGNOSTICS
+            this->template name_lock<wfc::IObservableMap<K, V>>();
+#endif
         }
 
         auto& get_container() noexcept
@@ -37,8 +40,8 @@ namespace winrt::impl
     template <typename K, typename V, typename Container>
     using observable_map = observable_map_impl<K, V, Container, single_threaded_collection_base>;
 
-    template <typename K, typename V, typename Container>
-    using multi_threaded_observable_map = observable_map_impl<K, V, Container, multi_threaded_collection_base>;
+    template <typename K, typename V, typename Container, typename Lock = slim_mutex>
+    using multi_threaded_observable_map = observable_map_impl<K, V, Container, multi_threaded_collection_base<Lock>>;
 }
 
 WINRT_EXPORT namespace winrt
@@ -61,22 +64,22 @@ WINRT_EXPORT namespace winrt
         return make<impl::input_map<K, V, std::unordered_map<K, V, Hash, KeyEqual, Allocator>>>(std::move(values));
     }
 
-    template <typename K, typename V, typename Compare = std::less<K>, typename Allocator = std::allocator<std::pair<K const, V>>>
+    template <typename K, typename V, typename Compare = std::less<K>, typename Allocator = std::allocator<std::pair<K const, V>>, typename Lock = slim_mutex>
     Windows::Foundation::Collections::IMap<K, V> multi_threaded_map()
     {
-        return make<impl::multi_threaded_map<K, V, std::map<K, V, Compare, Allocator>>>(std::map<K, V, Compare, Allocator>{});
+        return make<impl::multi_threaded_map<K, V, std::map<K, V, Compare, Allocator>, Lock>>(std::map<K, V, Compare, Allocator>{});
     }
 
-    template <typename K, typename V, typename Compare = std::less<K>, typename Allocator = std::allocator<std::pair<K const, V>>>
+    template <typename K, typename V, typename Compare = std::less<K>, typename Allocator = std::allocator<std::pair<K const, V>>, typename Lock = slim_mutex>
     Windows::Foundation::Collections::IMap<K, V> multi_threaded_map(std::map<K, V, Compare, Allocator>&& values)
     {
-        return make<impl::multi_threaded_map<K, V, std::map<K, V, Compare, Allocator>>>(std::move(values));
+        return make<impl::multi_threaded_map<K, V, std::map<K, V, Compare, Allocator>, Lock>>(std::move(values));
     }
 
-    template <typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>, typename Allocator = std::allocator<std::pair<K const, V>>>
+    template <typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>, typename Allocator = std::allocator<std::pair<K const, V>>, typename Lock = slim_mutex>
     Windows::Foundation::Collections::IMap<K, V> multi_threaded_map(std::unordered_map<K, V, Hash, KeyEqual, Allocator>&& values)
     {
-        return make<impl::multi_threaded_map<K, V, std::unordered_map<K, V, Hash, KeyEqual, Allocator>>>(std::move(values));
+        return make<impl::multi_threaded_map<K, V, std::unordered_map<K, V, Hash, KeyEqual, Allocator>, Lock>>(std::move(values));
     }
 
     template <typename K, typename V, typename Compare = std::less<K>, typename Allocator = std::allocator<std::pair<K const, V>>>
@@ -97,22 +100,22 @@ WINRT_EXPORT namespace winrt
         return make<impl::observable_map<K, V, std::unordered_map<K, V, Hash, KeyEqual, Allocator>>>(std::move(values));
     }
 
-    template <typename K, typename V, typename Compare = std::less<K>, typename Allocator = std::allocator<std::pair<K const, V>>>
+    template <typename K, typename V, typename Compare = std::less<K>, typename Allocator = std::allocator<std::pair<K const, V>>, typename Lock = slim_mutex>
     Windows::Foundation::Collections::IObservableMap<K, V> multi_threaded_observable_map()
     {
-        return make<impl::multi_threaded_observable_map<K, V, std::map<K, V, Compare, Allocator>>>(std::map<K, V, Compare, Allocator>{});
+        return make<impl::multi_threaded_observable_map<K, V, std::map<K, V, Compare, Allocator>, Lock>>(std::map<K, V, Compare, Allocator>{});
     }
 
-    template <typename K, typename V, typename Compare = std::less<K>, typename Allocator = std::allocator<std::pair<K const, V>>>
+    template <typename K, typename V, typename Compare = std::less<K>, typename Allocator = std::allocator<std::pair<K const, V>>, typename Lock = slim_mutex>
     Windows::Foundation::Collections::IObservableMap<K, V> multi_threaded_observable_map(std::map<K, V, Compare, Allocator>&& values)
     {
-        return make<impl::multi_threaded_observable_map<K, V, std::map<K, V, Compare, Allocator>>>(std::move(values));
+        return make<impl::multi_threaded_observable_map<K, V, std::map<K, V, Compare, Allocator>, Lock>>(std::move(values));
     }
 
-    template <typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>, typename Allocator = std::allocator<std::pair<K const, V>>>
+    template <typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>, typename Allocator = std::allocator<std::pair<K const, V>>, typename Lock = slim_mutex>
     Windows::Foundation::Collections::IObservableMap<K, V> multi_threaded_observable_map(std::unordered_map<K, V, Hash, KeyEqual, Allocator>&& values)
     {
-        return make<impl::multi_threaded_observable_map<K, V, std::unordered_map<K, V, Hash, KeyEqual, Allocator>>>(std::move(values));
+        return make<impl::multi_threaded_observable_map<K, V, std::unordered_map<K, V, Hash, KeyEqual, Allocator>, Lock>>(std::move(values));
     }
 }
 
@@ -1,8 +1,8 @@
 
 namespace winrt::impl
 {
-    template <typename T, typename Container>
-    using multi_threaded_vector = vector_impl<T, Container, multi_threaded_collection_base>;
+    template <typename T, typename Container, typename Lock = slim_mutex>
+    using multi_threaded_vector = vector_impl<T, Container, multi_threaded_collection_base<Lock>>;
 
     template <typename Container, typename ThreadingBase = single_threaded_collection_base>
     struct inspectable_observable_vector :
@@ -15,6 +15,9 @@ namespace winrt::impl
 
         explicit inspectable_observable_vector(Container&& values) : m_values(std::forward<Container>(values))
         {
+#ifdef WINRT_LOCK_DIAGNOSTICS
+            this->template name_lock<wfc::IObservableVector<Windows::Foundation::IInspectable>>();
+#endif
         }
 
         auto& get_container() noexcept
@@ -35,8 +38,8 @@ namespace winrt::impl
         Container m_values;
     };
 
-    template <typename Container>
-    using multi_threaded_inspectable_observable_vector = inspectable_observable_vector<Container, multi_threaded_collection_base>;
+    template <typename Container, typename Lock = slim_mutex>
+    using multi_threaded_inspectable_observable_vector = inspectable_observable_vector<Container, multi_threaded_collection_base<Lock>>;
 
     template <typename T, typename Container, typename ThreadingBase = single_threaded_collection_base>
     struct convertible_observable_vector :
@@ -54,6 +57,9 @@ namespace winrt::impl
 
         explicit convertible_observable_vector(Container&& values) : m_values(std::forward<Container>(values))
         {
+#ifdef WINRT_LOCK_DIAGNOSTICS
+            this->template name_lock<wfc::IObservableVector<T>>();
+#endif
         }
 
         auto& get_container() noexcept
@@ -293,8 +299,8 @@ namespace winrt::impl
         Container m_values;
     };
 
-    template <typename T, typename Container>
-    using multi_threaded_convertible_observable_vector = convertible_observable_vector<T, Container, multi_threaded_collection_base>;
+    template <typename T, typename Container, typename Lock = slim_mutex>
+    using multi_threaded_convertible_observable_vector = convertible_observable_vector<T, Container, multi_threaded_collection_base<Lock>>;
 }
 
 WINRT_EXPORT namespace winrt
@@ -305,10 +311,10 @@ WINRT_EXPORT namespace winrt
         return make<impl::input_vector<T, std::vector<T, Allocator>>>(std::move(values));
     }
 
-    template <typename T, typename Allocator = std::allocator<T>>
+    template <typename T, typename Allocator = std::allocator<T>, typename Lock = slim_mutex>
     Windows::Foundation::Collections::IVector<T> multi_threaded_vector(std::vector<T, Allocator>&& values = {})
     {
-        return make<impl::multi_threaded_vector<T, std::vector<T, Allocator>>>(std::move(values));
+        return make<impl::multi_threaded_vector<T, std::vector<T, Allocator>, Lock>>(std::move(values));
     }
 
     template <typename T, typename Allocator = std::allocator<T>>
@@ -324,16 +330,16 @@ WINRT_EXPORT namespace winrt
         }
     }
 
-    template <typename T, typename Allocator = std::allocator<T>>
+    template <typename T, typename Allocator = std::allocator<T>, typename Lock = slim_mutex>
     Windows::Foundation::Collections::IObservableVector<T> multi_threaded_observable_vector(std::vector<T, Allocator>&& values = {})
     {
         if constexpr (std::is_same_v<T, Windows::Foundation::IInspectable>)
         {
-            return make<impl::multi_threaded_inspectable_observable_vector<std::vector<T, Allocator>>>(std::move(values));
+            return make<impl::multi_threaded_inspectable_observable_vector<std::vector<T, Allocator>, Lock>>(std::move(values));
         }
         else
         {
-            return make<impl::multi_threaded_convertible_observable_vector<T, std::vector<T, Allocator>>>(std::move(values));
+            return make<impl::multi_threaded_convertible_observable_vector<T, std::vector<T, Allocator>, Lock>>(std::move(values));
         }
     }
 }
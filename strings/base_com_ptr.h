@@ -21,6 +21,14 @@ namespace winrt::impl
 
     template <typename T, typename O, typename M, typename...Args>
     int32_t capture_to(void** result, com_ptr<O> const& object, M method, Args&& ...args);
+
+    // Only types whose sole member is an owning interface pointer may be borrowed. Other pointer-sized types, such as
+    // hstring or handle, would be released or reinterpreted incorrectly.
+    template <typename T>
+    inline constexpr bool is_borrowable_v = std::is_base_of_v<Windows::Foundation::IUnknown, T>;
+
+    template <typename T>
+    inline constexpr bool is_borrowable_v<com_ptr<T>> = true;
 }
 
 WINRT_EXPORT namespace winrt
@@ -336,6 +344,130 @@ WINRT_EXPORT namespace winrt
     {
         return !(left < right);
     }
+
+    // A non-owning reference to a projected object or com_ptr that may be copied and stored without touching the
+    // reference count. The referenced object must outlive it. Debug builds hold a real reference instead and assert
+    // when a borrowed reference turns out to be the last one, meaning it outlived its owner.
+    template <typename T>
+    struct borrowed
+    {
+        static_assert(impl::is_borrowable_v<T>, "Only projected types and com_ptr may be borrowed.");
+        static_assert(sizeof(T) == sizeof(void*));
+
+        using type = T;
+
+        borrowed() noexcept = default;
+
+        borrowed(std::nullptr_t) noexcept
+        {
+        }
+
+        borrowed(T const& value) noexcept : m_ptr(*reinterpret_cast<void* const*>(&value))
+        {
+            add_ref();
+        }
+
+        borrowed(borrowed const& other) noexcept : m_ptr(other.m_ptr)
+        {
+            add_ref();
+        }
+
+        borrowed& operator=(borrowed const& other) noexcept
+        {
+            if (this != &other)
+            {
+                release_ref();
+                m_ptr = other.m_ptr;
+                add_ref();
+            }
+
+            return *this;
+        }
+
+        ~borrowed() noexcept
+        {
+            release_ref();
+        }
+
+        T const& get() const noexcept
+        {
+            return *reinterpret_cast<T const*>(&m_ptr);
+        }
+
+        operator T const&() const noexcept
+        {
+            return get();
+        }
+
+        T const* operator->() const noexcept
+        {
+            return &get();
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return m_ptr != nullptr;
+        }
+
+    private:
+
+#ifdef _DEBUG
+        static uint32_t add_ref(void* ptr) noexcept
+        {
+            return static_cast<impl::unknown_abi*>(ptr)->AddRef();
+        }
+
+        template <typename U>
+        static uint32_t add_ref(U* ptr) noexcept
+        {
+            return ptr->AddRef();
+        }
+
+        static uint32_t release_ref(void* ptr) noexcept
+        {
+            return static_cast<impl::unknown_abi*>(ptr)->Release();
+        }
+
+        template <typename U>
+        static uint32_t release_ref(U* ptr) noexcept
+        {
+            return ptr->Release();
+        }
+
+        void add_ref() const noexcept
+        {
+            if (m_ptr)
+            {
+                add_ref(get_abi(get()));
+            }
+        }
+
+        void release_ref() const noexcept
+        {
+            if (m_ptr)
+            {
+                [[maybe_unused]] uint32_t const remaining = release_ref(get_abi(get()));
+                WINRT_ASSERT(remaining != 0);
+            }
+        }
+#else
+        void add_ref() const noexcept
+        {
+        }
+
+        void release_ref() const noexcept
+        {
+        }
+#endif
+
+        void* m_ptr{};
+    };
+
+    template <typename T, std::enable_if_t<impl::is_borrowable_v<T>, int> = 0>
+    borrowed<T> borrow(T const& value) noexcept
+    {
+        return value;
+    }
 }
 
 namespace winrt::impl
@@ -360,6 +360,20 @@ namespace winrt::impl
             m_promise->set_progress(result);
         }
 
+        // Coalesces reports that arrive within interval of the last one delivered. Throttling is on the leading edge
+        // only: nothing fires when the interval expires, so the newest coalesced value is held until the next report
+        // or until the coroutine completes, and handlers may show an older value throughout a long quiet phase.
+        void throttle(Windows::Foundation::TimeSpan const& interval) const noexcept
+        {
+            static_assert(!std::is_same_v<Progress, void>, "Throttling progress requires IAsync...WithProgress");
+            m_promise->set_progress_interval(interval);
+        }
+
+        uint64_t dropped() const noexcept
+        {
+            return m_promise->dropped_progress();
+        }
+
         template<typename T>
         void set_result(T&& value) const
         {
@@ -372,11 +386,72 @@ namespace winrt::impl
         Promise* m_promise;
     };
 
+    // Reports arriving within the interval of the last delivered report are coalesced, with the
+    // latest value winning. A coalesced value stays pending until a later report is admitted, which
+    // replaces it, or until final_suspend delivers it before the Completed handler runs.
+    template <typename TProgress>
+    struct progress_throttle
+    {
+        bool admit(TProgress const& value)
+        {
+            if (m_interval.count() == 0)
+            {
+                return true;
+            }
+
+            auto const now = std::chrono::steady_clock::now();
+
+            if (m_pending)
+            {
+                ++m_dropped;
+            }
+
+            if (now - m_last >= m_interval)
+            {
+                m_last = now;
+                m_pending.reset();
+                return true;
+            }
+
+            m_pending = value;
+            return false;
+        }
+
+        std::optional<TProgress> take_pending() noexcept
+        {
+            return std::exchange(m_pending, {});
+        }
+
+        void interval(Windows::Foundation::TimeSpan const& value) noexcept
+        {
+            m_interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(value);
+        }
+
+        uint64_t dropped() const noexcept
+        {
+            return m_dropped;
+        }
+
+    private:
+
+        std::chrono::steady_clock::duration m_interval{};
+        std::chrono::steady_clock::time_point m_last{};
+        std::optional<TProgress> m_pending;
+        uint64_t m_dropped{};
+    };
+
     template <typename Derived, typename AsyncInterface, typename TProgress = void>
     struct promise_base : implements<Derived, AsyncInterface, Windows::Foundation::IAsyncInfo>
     {
         using AsyncStatus = Windows::Foundation::AsyncStatus;
 
+#ifdef WINRT_LOCK_DIAGNOSTICS
+        promise_base()
+        {
+            impl::name_lock<AsyncInterface>(m_lock);
+        }
+
+#endif
         unsigned long __stdcall Release() noexcept
         {
             uint32_t const remaining = this->subtract_reference();
@@ -519,6 +594,10 @@ namespace winrt::impl
         {
         }
 
+        void flush_progress() const noexcept
+        {
+        }
+
         void set_completed() noexcept
         {
             async_completed_handler_t<AsyncInterface> handler;
@@ -577,6 +656,10 @@ namespace winrt::impl
 
         auto final_suspend() noexcept
         {
+            // Every way out of the coroutine body passes through here, so a throttled progress report that is still
+            // pending is delivered whether the coroutine returned, threw, or was canceled.
+            static_cast<Derived*>(this)->flush_progress();
+
             if (winrt_suspend_handler)
             {
                 winrt_suspend_handler(this);
@@ -718,13 +801,56 @@ namespace std::experimental
 
             void set_progress(TProgress const& result)
             {
-                if (auto handler = Progress())
+                ProgressHandler handler;
+
+                {
+                    winrt::slim_lock_guard const guard(this->m_lock);
+
+                    if (!m_throttle.admit(result))
+                    {
+                        return;
+                    }
+
+                    handler = m_progress;
+                }
+
+                if (handler)
                 {
                     winrt::impl::invoke(handler, *this, result);
                 }
             }
 
+            void set_progress_interval(winrt::Windows::Foundation::TimeSpan const& interval) noexcept
+            {
+                winrt::slim_lock_guard const guard(this->m_lock);
+                m_throttle.interval(interval);
+            }
+
+            uint64_t dropped_progress() noexcept
+            {
+                winrt::slim_lock_guard const guard(this->m_lock);
+                return m_throttle.dropped();
+            }
+
+            void flush_progress() noexcept
+            {
+                ProgressHandler handler;
+                std::optional<TProgress> pending;
+
+                {
+                    winrt::slim_lock_guard const guard(this->m_lock);
+                    pending = m_throttle.take_pending();
+                    handler = m_progress;
+                }
+
+                if (pending && handler)
+                {
+                    winrt::impl::invoke(handler, *this, *pending);
+                }
+            }
+
             ProgressHandler m_progress;
+            winrt::impl::progress_throttle<TProgress> m_throttle;
         };
     };
 
@@ -801,14 +927,57 @@ namespace std::experimental
 
             void set_progress(TProgress const& result)
             {
-                if (auto handler = Progress())
+                ProgressHandler handler;
+
+                {
+                    winrt::slim_lock_guard const guard(this->m_lock);
+
+                    if (!m_throttle.admit(result))
+                    {
+                        return;
+                    }
+
+                    handler = m_progress;
+                }
+
+                if (handler)
                 {
                     winrt::impl::invoke(handler, *this, result);
                 }
             }
 
+            void set_progress_interval(winrt::Windows::Foundation::TimeSpan const& interval) noexcept
+            {
+                winrt::slim_lock_guard const guard(this->m_lock);
+                m_throttle.interval(interval);
+            }
+
+            uint64_t dropped_progress() noexcept
+            {
+                winrt::slim_lock_guard const guard(this->m_lock);
+                return m_throttle.dropped();
+            }
+
+            void flush_progress() noexcept
+            {
+                ProgressHandler handler;
+                std::optional<TProgress> pending;
+
+                {
+                    winrt::slim_lock_guard const guard(this->m_lock);
+                    pending = m_throttle.take_pending();
+                    handler = m_progress;
+                }
+
+                if (pending && handler)
+                {
+                    winrt::impl::invoke(handler, *this, *pending);
+                }
+            }
+
             TResult m_result{ winrt::impl::empty_value<TResult>() };
             ProgressHandler m_progress;
+            winrt::impl::progress_throttle<TProgress> m_throttle;
         };
     };
 }
@@ -839,7 +1008,7 @@ WINRT_EXPORT namespace winrt
             {
                 auto sender_abi = *(impl::unknown_abi**)&sender;
 
-                if (nullptr == _InterlockedCompareExchangePointer(reinterpret_cast<void**>(&result), sender_abi, nullptr))
+                if (nullptr == impl::interlocked_compare_exchange_pointer(reinterpret_cast<void**>(&result), sender_abi, nullptr))
                 {
                     sender_abi->AddRef();
                     status = operation_status;
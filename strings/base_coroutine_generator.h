@@ -0,0 +1,474 @@
+
+WINRT_EXPORT namespace winrt
+{
+    template <typename T, uint32_t Capacity = 1>
+    struct async_generator;
+}
+
+namespace winrt::impl
+{
+    template <typename T, uint32_t Capacity>
+    struct async_generator_promise
+    {
+        using AsyncStatus = Windows::Foundation::AsyncStatus;
+        using handle_type = coroutine_handle<async_generator_promise>;
+
+        async_generator<T, Capacity> get_return_object() noexcept
+        {
+            return async_generator<T, Capacity>{ handle_type::from_promise(*this) };
+        }
+
+        suspend_always initial_suspend() const noexcept
+        {
+            return{};
+        }
+
+        struct final_suspend_awaiter
+        {
+            async_generator_promise* promise;
+
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            void await_resume() const noexcept
+            {
+            }
+
+            bool await_suspend(coroutine_handle<>) const noexcept
+            {
+                promise->set_completed();
+                return promise->release() > 0;
+            }
+        };
+
+        final_suspend_awaiter final_suspend() noexcept
+        {
+            if (winrt_suspend_handler)
+            {
+                winrt_suspend_handler(this);
+            }
+
+            return{ this };
+        }
+
+        void return_void() const noexcept
+        {
+        }
+
+        void unhandled_exception() noexcept
+        {
+            slim_lock_guard const guard(m_lock);
+            m_exception = std::current_exception();
+        }
+
+        struct yield_awaiter
+        {
+            async_generator_promise* promise;
+
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            bool await_suspend(coroutine_handle<> handle)
+            {
+                return promise->suspend_producer(handle);
+            }
+
+            void await_resume() const
+            {
+                if (promise->Status() == AsyncStatus::Canceled)
+                {
+                    throw hresult_canceled();
+                }
+            }
+        };
+
+        yield_awaiter yield_value(T const& value)
+        {
+            push(T(value));
+            return{ this };
+        }
+
+        yield_awaiter yield_value(T&& value)
+        {
+            push(std::move(value));
+            return{ this };
+        }
+
+        template <typename Expression>
+        auto await_transform(Expression&& expression)
+        {
+            if (Status() == AsyncStatus::Canceled)
+            {
+                throw hresult_canceled();
+            }
+
+            return notify_awaiter<Expression>{ static_cast<Expression&&>(expression), m_propagate_cancellation ? &m_cancellable : nullptr };
+        }
+
+        cancellation_token<async_generator_promise> await_transform(get_cancellation_token_t) noexcept
+        {
+            return{ this };
+        }
+
+        AsyncStatus Status() noexcept
+        {
+            return m_canceled.load(std::memory_order_acquire) ? AsyncStatus::Canceled : AsyncStatus::Started;
+        }
+
+        void cancellation_callback(winrt::delegate<>&& cancel) noexcept
+        {
+            {
+                slim_lock_guard const guard(m_lock);
+
+                if (!m_canceled.load(std::memory_order_relaxed))
+                {
+                    m_cancel = std::move(cancel);
+                    return;
+                }
+            }
+
+            if (cancel)
+            {
+                cancel();
+            }
+        }
+
+        bool enable_cancellation_propagation(bool value) noexcept
+        {
+            return std::exchange(m_propagate_cancellation, value);
+        }
+
+        bool consumer_ready() noexcept
+        {
+            slim_lock_guard const guard(m_lock);
+            return m_count > 0 || m_completed;
+        }
+
+        bool suspend_consumer(coroutine_handle<> handle)
+        {
+            resume_apartment_context context;
+            coroutine_handle<> producer;
+
+            {
+                slim_lock_guard const guard(m_lock);
+
+                if (m_count > 0 || m_completed)
+                {
+                    return false;
+                }
+
+                m_consumer = handle;
+                m_consumer_context = std::move(context);
+
+                if (!m_started)
+                {
+                    m_started = true;
+                    producer = handle_type::from_promise(*this);
+                }
+            }
+
+            // The producer may resume the consumer, and even run to completion, before this returns.
+            if (producer)
+            {
+                producer();
+            }
+
+            return true;
+        }
+
+        std::optional<T> pop()
+        {
+            std::optional<T> result;
+            coroutine_handle<> producer;
+
+            {
+                slim_lock_guard const guard(m_lock);
+                check_hresult(std::exchange(m_failure, 0));
+
+                if (m_canceled.load(std::memory_order_relaxed))
+                {
+                    throw hresult_canceled();
+                }
+
+                if (m_count == 0)
+                {
+                    WINRT_ASSERT(m_completed);
+
+                    if (m_exception)
+                    {
+                        std::rethrow_exception(std::exchange(m_exception, {}));
+                    }
+
+                    return result;
+                }
+
+                result = std::move(m_buffer[m_head]);
+                m_buffer[m_head].reset();
+                m_head = (m_head + 1) % Capacity;
+                --m_count;
+                producer = std::exchange(m_producer, {});
+            }
+
+            // Let a producer blocked on a full buffer refill it.
+            if (producer)
+            {
+                producer();
+            }
+
+            return result;
+        }
+
+        void cancel() noexcept
+        {
+            winrt::delegate<> cancel;
+            coroutine_handle<> producer;
+
+            {
+                slim_lock_guard const guard(m_lock);
+
+                if (m_canceled.exchange(true, std::memory_order_release))
+                {
+                    return;
+                }
+
+                cancel = std::move(m_cancel);
+                producer = std::exchange(m_producer, {});
+            }
+
+            if (cancel)
+            {
+                cancel();
+            }
+
+            m_cancellable.cancel();
+
+            if (producer)
+            {
+                producer();
+            }
+        }
+
+        bool started() const noexcept
+        {
+            return m_started;
+        }
+
+        uint32_t release() noexcept
+        {
+            return m_references.fetch_sub(1, std::memory_order_acq_rel) - 1;
+        }
+
+    private:
+
+        void push(T&& value)
+        {
+            coroutine_handle<> consumer;
+            resume_apartment_context context{ nullptr };
+
+            {
+                slim_lock_guard const guard(m_lock);
+
+                if (m_canceled.load(std::memory_order_relaxed))
+                {
+                    return;
+                }
+
+                WINRT_ASSERT(m_count < Capacity);
+                m_buffer[(m_head + m_count) % Capacity].emplace(std::move(value));
+                ++m_count;
+                consumer = std::exchange(m_consumer, {});
+                context = std::move(m_consumer_context);
+            }
+
+            if (consumer)
+            {
+                resume_apartment(context, consumer, &m_failure);
+            }
+        }
+
+        bool suspend_producer(coroutine_handle<> handle) noexcept
+        {
+            slim_lock_guard const guard(m_lock);
+
+            if (m_canceled.load(std::memory_order_relaxed) || m_count < Capacity)
+            {
+                return false;
+            }
+
+            m_producer = handle;
+            return true;
+        }
+
+        void set_completed() noexcept
+        {
+            coroutine_handle<> consumer;
+            resume_apartment_context context{ nullptr };
+
+            {
+                slim_lock_guard const guard(m_lock);
+                m_completed = true;
+                consumer = std::exchange(m_consumer, {});
+                context = std::move(m_consumer_context);
+            }
+
+            if (consumer)
+            {
+                resume_apartment(context, consumer, &m_failure);
+            }
+        }
+
+        slim_mutex m_lock;
+        std::array<std::optional<T>, Capacity> m_buffer;
+        uint32_t m_head{};
+        uint32_t m_count{};
+        coroutine_handle<> m_producer{ nullptr };
+        coroutine_handle<> m_consumer{ nullptr };
+        resume_apartment_context m_consumer_context{ nullptr };
+        int32_t m_failure{};
+        std::exception_ptr m_exception{};
+        winrt::delegate<> m_cancel;
+        cancellable_promise m_cancellable;
+        std::atomic<uint32_t> m_references{ 2 }; // consumer and producer
+        std::atomic<bool> m_canceled{ false };
+        bool m_started{ false };
+        bool m_completed{ false };
+        bool m_propagate_cancellation{ false };
+    };
+}
+
+WINRT_EXPORT namespace winrt
+{
+    template <typename T, uint32_t Capacity>
+    struct async_generator
+    {
+        static_assert(Capacity > 0, "The buffer must hold at least one value.");
+
+        using promise_type = impl::async_generator_promise<T, Capacity>;
+
+        async_generator(async_generator const&) = delete;
+        async_generator& operator=(async_generator const&) = delete;
+
+        async_generator(async_generator&& other) noexcept :
+            m_handle(std::exchange(other.m_handle, {}))
+        {
+        }
+
+        async_generator& operator=(async_generator&& other) noexcept
+        {
+            if (this != &other)
+            {
+                close();
+                m_handle = std::exchange(other.m_handle, {});
+            }
+
+            return *this;
+        }
+
+        ~async_generator()
+        {
+            close();
+        }
+
+        [[nodiscard]] auto next() noexcept
+        {
+            struct awaitable : enable_await_cancellation
+            {
+                explicit awaitable(promise_type& promise) noexcept : m_promise(promise)
+                {
+                }
+
+                void enable_cancellation(cancellable_promise* promise)
+                {
+                    promise->set_canceller([](void* context)
+                    {
+                        static_cast<promise_type*>(context)->cancel();
+                    }, &m_promise);
+                }
+
+                bool await_ready() noexcept
+                {
+                    return m_promise.consumer_ready();
+                }
+
+                bool await_suspend(impl::coroutine_handle<> handle)
+                {
+                    return m_promise.suspend_consumer(handle);
+                }
+
+                std::optional<T> await_resume()
+                {
+                    return m_promise.pop();
+                }
+
+            private:
+
+                promise_type& m_promise;
+            };
+
+            WINRT_ASSERT(m_handle);
+            return awaitable{ m_handle.promise() };
+        }
+
+        void cancel() noexcept
+        {
+            if (m_handle)
+            {
+                m_handle.promise().cancel();
+            }
+        }
+
+    private:
+
+        friend promise_type;
+
+        explicit async_generator(impl::coroutine_handle<promise_type> handle) noexcept :
+            m_handle(handle)
+        {
+        }
+
+        void close() noexcept
+        {
+            if (auto handle = std::exchange(m_handle, {}))
+            {
+                auto& promise = handle.promise();
+
+                if (!promise.started())
+                {
+                    handle.destroy();
+                    return;
+                }
+
+                promise.cancel();
+
+                if (promise.release() == 0)
+                {
+                    handle.destroy();
+                }
+            }
+        }
+
+        impl::coroutine_handle<promise_type> m_handle{ nullptr };
+    };
+
+#ifdef WINRT_IMPL_COROUTINES
+    template <typename T, uint32_t Capacity, typename F>
+    Windows::Foundation::IAsyncAction for_each(async_generator<T, Capacity> generator, F callback)
+    {
+        while (auto value = co_await generator.next())
+        {
+            if constexpr (std::is_void_v<std::invoke_result_t<F&, T&&>>)
+            {
+                callback(std::move(*value));
+            }
+            else
+            {
+                co_await callback(std::move(*value));
+            }
+        }
+    }
+#endif
+}
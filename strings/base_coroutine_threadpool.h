@@ -19,6 +19,16 @@ namespace winrt::impl
         submit_threadpool_callback(resume_background_callback, handle.address());
     }
 
+    inline void resume_background_or_inline(coroutine_handle<> handle) noexcept
+    {
+        // Used by dedicated service threads that cannot report failure, so fall back to
+        // resuming on the calling thread.
+        if (!WINRT_IMPL_TrySubmitThreadpoolCallback(resume_background_callback, handle.address(), nullptr))
+        {
+            handle();
+        }
+    }
+
     inline std::pair<int32_t, int32_t> get_apartment_type() noexcept
     {
         int32_t aptType;
@@ -33,6 +43,11 @@ namespace winrt::impl
         }
     }
 
+    inline bool is_mta_thread() noexcept
+    {
+        return get_apartment_type().first == 1 /* APTTYPE_MTA */;
+    }
+
     inline bool is_sta_thread() noexcept
     {
         auto type = get_apartment_type();
@@ -50,7 +65,15 @@ namespace winrt::impl
 
     struct resume_apartment_context
     {
-        resume_apartment_context() = default;
+        resume_apartment_context() : m_context_type(get_apartment_type().first)
+        {
+            // All MTA threads share a single context, so there is nothing to capture or compare.
+            if (m_context_type != 1 /* APTTYPE_MTA */)
+            {
+                m_context = try_capture<IContextCallback>(WINRT_IMPL_CoGetObjectContext);
+            }
+        }
+
         resume_apartment_context(std::nullptr_t) : m_context(nullptr), m_context_type(-1) {}
         resume_apartment_context(resume_apartment_context const&) = default;
         resume_apartment_context(resume_apartment_context&& other) noexcept :
@@ -67,8 +90,8 @@ namespace winrt::impl
             return m_context_type >= 0;
         }
 
-        com_ptr<IContextCallback> m_context = try_capture<IContextCallback>(WINRT_IMPL_CoGetObjectContext);
-        int32_t m_context_type = get_apartment_type().first;
+        com_ptr<IContextCallback> m_context;
+        int32_t m_context_type = -1;
     };
 
     inline int32_t __stdcall resume_apartment_callback(com_callback_args* args) noexcept
@@ -116,13 +139,20 @@ namespace winrt::impl
     inline auto resume_apartment(resume_apartment_context const& context, coroutine_handle<> handle, int32_t* failure)
     {
         WINRT_ASSERT(context.valid());
-        if ((context.m_context == nullptr) || (context.m_context == try_capture<IContextCallback>(WINRT_IMPL_CoGetObjectContext)))
+        if (context.m_context_type == 1 /* APTTYPE_MTA */)
         {
-            handle();
+            if (is_mta_thread())
+            {
+                handle();
+            }
+            else
+            {
+                resume_background(handle);
+            }
         }
-        else if (context.m_context_type == 1 /* APTTYPE_MTA */)
+        else if ((context.m_context == nullptr) || (context.m_context == try_capture<IContextCallback>(WINRT_IMPL_CoGetObjectContext)))
         {
-            resume_background(handle);
+            handle();
         }
         else if (is_sta_thread())
         {
@@ -408,9 +438,429 @@ WINRT_EXPORT namespace winrt
         return{ context };
     }
 #endif
+}
+
+namespace winrt::impl
+{
+    enum class timer_wheel_state { idle, pending, canceled };
+
+    struct timer_wheel_node
+    {
+        timer_wheel_node* next{};
+        timer_wheel_node* prev{};
+    };
+
+    struct timer_wheel_entry : timer_wheel_node
+    {
+        std::chrono::steady_clock::time_point due{};
+        uint64_t deadline{};
+        timer_wheel_entry* expired{};
+        coroutine_handle<> resume{ nullptr };
+        std::atomic<timer_wheel_state> state{ timer_wheel_state::idle };
+    };
+}
+
+WINRT_EXPORT namespace winrt
+{
+    struct timer_wheel_metrics
+    {
+        uint64_t scheduled{};
+        uint64_t fired{};
+        uint64_t canceled{};
+        uint32_t pending{};
+        Windows::Foundation::TimeSpan total_lag{};
+        Windows::Foundation::TimeSpan max_lag{};
+    };
+
+    struct timer_wheel
+    {
+        timer_wheel(timer_wheel const&) = delete;
+        timer_wheel& operator=(timer_wheel const&) = delete;
+
+        explicit timer_wheel(Windows::Foundation::TimeSpan const resolution = std::chrono::milliseconds{ 1 }) :
+            m_resolution(std::chrono::duration_cast<std::chrono::steady_clock::duration>(resolution)),
+            m_start(std::chrono::steady_clock::now())
+        {
+            WINRT_ASSERT(m_resolution.count() > 0);
+
+            for (auto&& level : m_slots)
+            {
+                for (auto&& slot : level)
+                {
+                    slot.next = &slot;
+                    slot.prev = &slot;
+                }
+            }
+        }
+
+        ~timer_wheel()
+        {
+            {
+                slim_lock_guard const guard(m_lock);
+                WINRT_ASSERT(m_metrics.pending == 0); // The wheel must outlive the coroutines awaiting it.
+                m_stopping = true;
+                m_condition.notify_one();
+            }
+
+            if (m_thread.joinable())
+            {
+                m_thread.join();
+            }
+        }
+
+        [[nodiscard]] auto resume_after(Windows::Foundation::TimeSpan duration) noexcept
+        {
+            struct awaitable : enable_await_cancellation, impl::timer_wheel_entry
+            {
+                awaitable(timer_wheel& wheel, Windows::Foundation::TimeSpan duration) noexcept :
+                    m_wheel(wheel),
+                    m_duration(duration)
+                {
+                }
+
+                void enable_cancellation(cancellable_promise* promise)
+                {
+                    promise->set_canceller([](void* context)
+                    {
+                        auto that = static_cast<awaitable*>(context);
+                        if (that->state.exchange(impl::timer_wheel_state::canceled, std::memory_order_acquire) == impl::timer_wheel_state::pending)
+                        {
+                            that->m_wheel.cancel(that);
+                        }
+                    }, this);
+                }
+
+                bool await_ready() const noexcept
+                {
+                    return m_duration.count() <= 0;
+                }
+
+                bool await_suspend(impl::coroutine_handle<> handle)
+                {
+                    resume = handle;
+                    return m_wheel.schedule(this, m_duration);
+                }
+
+                void await_resume()
+                {
+                    if (state.exchange(impl::timer_wheel_state::idle, std::memory_order_relaxed) == impl::timer_wheel_state::canceled)
+                    {
+                        throw hresult_canceled();
+                    }
+                }
+
+            private:
+
+                timer_wheel& m_wheel;
+                Windows::Foundation::TimeSpan m_duration;
+            };
+
+            return awaitable{ *this, duration };
+        }
+
+        timer_wheel_metrics metrics()
+        {
+            slim_lock_guard const guard(m_lock);
+            return m_metrics;
+        }
+
+    private:
+
+        // Four levels of 256 slots cover 2^32 ticks; anything further out is parked in the
+        // last level and re-inserted as the wheel turns.
+        static constexpr uint32_t slot_bits{ 8 };
+        static constexpr uint32_t slot_count{ 1 << slot_bits };
+        static constexpr uint32_t slot_mask{ slot_count - 1 };
+        static constexpr uint32_t level_count{ 4 };
+        static constexpr uint64_t no_deadline{ ~uint64_t{} };
+
+        bool schedule(impl::timer_wheel_entry* entry, Windows::Foundation::TimeSpan const duration)
+        {
+            auto const now = std::chrono::steady_clock::now();
+            auto const due = now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(duration);
+            slim_lock_guard const guard(m_lock);
+
+            auto expected = impl::timer_wheel_state::idle;
+            if (!entry->state.compare_exchange_strong(expected, impl::timer_wheel_state::pending, std::memory_order_release))
+            {
+                // Canceled before it was scheduled, so don't suspend at all.
+                return false;
+            }
+
+            if (!m_thread.joinable())
+            {
+                m_thread = std::thread([this] { run(); });
+            }
+
+            // The wheel may have been idle for a while, so first move it up to the present over any ticks on which
+            // nothing is due. Otherwise the entry would be placed relative to a stale tick.
+            m_current = (std::max)(m_current, (std::min)(floor_tick(now), next_event() - 1));
+            entry->due = due;
+            entry->deadline = (std::max)(ceil_tick(due), m_current + 1);
+            insert(entry);
+            ++m_metrics.scheduled;
+            ++m_metrics.pending;
+
+            if (entry->deadline < m_wake)
+            {
+                m_wake = entry->deadline;
+                m_condition.notify_one();
+            }
+
+            return true;
+        }
+
+        void cancel(impl::timer_wheel_entry* entry) noexcept
+        {
+            impl::coroutine_handle<> resume;
+
+            {
+                slim_lock_guard const guard(m_lock);
+
+                if (!entry->next)
+                {
+                    // Already expired and its resumption is on its way.
+                    return;
+                }
+
+                unlink(entry);
+                --m_metrics.pending;
+                ++m_metrics.canceled;
+                resume = entry->resume;
+            }
+
+            impl::resume_background_or_inline(resume);
+        }
+
+        uint64_t ceil_tick(std::chrono::steady_clock::time_point const time) const noexcept
+        {
+            return static_cast<uint64_t>(((time - m_start) + m_resolution - std::chrono::steady_clock::duration{ 1 }) / m_resolution);
+        }
+
+        uint64_t floor_tick(std::chrono::steady_clock::time_point const time) const noexcept
+        {
+            return static_cast<uint64_t>((time - m_start) / m_resolution);
+        }
+
+        static void unlink(impl::timer_wheel_node* node) noexcept
+        {
+            node->prev->next = node->next;
+            node->next->prev = node->prev;
+            node->next = nullptr;
+            node->prev = nullptr;
+        }
+
+        static bool empty(impl::timer_wheel_node const& slot) noexcept
+        {
+            return slot.next == &slot;
+        }
+
+        void insert(impl::timer_wheel_entry* entry) noexcept
+        {
+            uint64_t placement = (std::max)(entry->deadline, m_current);
+            uint32_t level = 0;
+
+            while (level < level_count - 1 && (placement - m_current) >> (slot_bits * (level + 1)))
+            {
+                ++level;
+            }
+
+            if ((placement - m_current) >> (slot_bits * level_count))
+            {
+                placement = m_current + (uint64_t{ 1 } << (slot_bits * level_count)) - 1;
+            }
+
+            auto& slot = m_slots[level][(placement >> (slot_bits * level)) & slot_mask];
+            entry->prev = slot.prev;
+            entry->next = &slot;
+            slot.prev->next = entry;
+            slot.prev = entry;
+        }
+
+        void cascade(impl::timer_wheel_node& slot) noexcept
+        {
+            while (!empty(slot))
+            {
+                auto entry = static_cast<impl::timer_wheel_entry*>(slot.next);
+                unlink(entry);
+                insert(entry);
+            }
+        }
+
+        void advance(impl::timer_wheel_entry*& expired) noexcept
+        {
+            ++m_current;
+
+            for (uint32_t level = 1; level < level_count; ++level)
+            {
+                if (m_current & ((uint64_t{ 1 } << (slot_bits * level)) - 1))
+                {
+                    break;
+                }
+
+                cascade(m_slots[level][(m_current >> (slot_bits * level)) & slot_mask]);
+            }
+
+            auto& slot = m_slots[0][m_current & slot_mask];
+
+            while (!empty(slot))
+            {
+                auto entry = static_cast<impl::timer_wheel_entry*>(slot.next);
+                unlink(entry);
+
+                if (entry->deadline > m_current)
+                {
+                    insert(entry);
+                }
+                else
+                {
+                    --m_metrics.pending;
+                    entry->expired = expired;
+                    expired = entry;
+                }
+            }
+        }
+
+        // The next tick on which advance expires or cascades any entries. The ticks before it may be skipped.
+        uint64_t next_event() const noexcept
+        {
+            if (m_metrics.pending == 0)
+            {
+                return no_deadline;
+            }
+
+            uint64_t result{ no_deadline };
+
+            for (uint32_t level = 0; level < level_count; ++level)
+            {
+                uint32_t const shift = slot_bits * level;
+                uint64_t const first = (m_current >> shift) + 1;
+
+                // A level is only processed on its boundaries, so it can't come before an earlier level's event.
+                if ((first << shift) >= result)
+                {
+                    break;
+                }
+
+                for (uint64_t index = first; index < first + slot_count; ++index)
+                {
+                    if (!empty(m_slots[level][index & slot_mask]))
+                    {
+                        result = index << shift;
+                        break;
+                    }
+                }
+            }
+
+            return result;
+        }
+
+        void fire(impl::timer_wheel_entry* expired) noexcept
+        {
+            auto const now = std::chrono::steady_clock::now();
+
+            {
+                slim_lock_guard const guard(m_lock);
+
+                for (auto entry = expired; entry; entry = entry->expired)
+                {
+                    auto const lag = (std::max)(std::chrono::duration_cast<Windows::Foundation::TimeSpan>(now - entry->due), Windows::Foundation::TimeSpan{});
+                    m_metrics.total_lag += lag;
+                    m_metrics.max_lag = (std::max)(m_metrics.max_lag, lag);
+                    ++m_metrics.fired;
+                }
+            }
+
+            while (expired)
+            {
+                // The entry lives in the coroutine frame, so move on before resuming it.
+                auto const resume = expired->resume;
+                expired = expired->expired;
+                impl::resume_background_or_inline(resume);
+            }
+        }
+
+        void run() noexcept
+        {
+            m_lock.lock();
+
+            while (!m_stopping)
+            {
+                auto const now = floor_tick(std::chrono::steady_clock::now());
+                impl::timer_wheel_entry* expired{};
+
+                // Jump from one occupied slot to the next rather than turning the wheel a tick at a time.
+                while (m_current < now)
+                {
+                    auto const next = next_event();
+
+                    if (next > now)
+                    {
+                        m_current = now;
+                        break;
+                    }
+
+                    m_current = next - 1;
+                    advance(expired);
+                }
+
+                if (expired)
+                {
+                    m_lock.unlock();
+                    fire(expired);
+                    m_lock.lock();
+                    continue;
+                }
+
+                auto const planned = m_wake = next_event();
+
+                if (planned == no_deadline)
+                {
+                    m_condition.wait(m_lock, [&] { return m_stopping || m_wake != planned; });
+                }
+                else
+                {
+                    auto const timeout = (m_start + m_resolution * static_cast<int64_t>(planned)) - std::chrono::steady_clock::now();
+                    m_condition.wait_for(m_lock, std::chrono::duration_cast<std::chrono::high_resolution_clock::duration>(timeout), [&] { return m_stopping || m_wake != planned; });
+                }
+            }
+
+            m_lock.unlock();
+        }
+
+        std::chrono::steady_clock::duration const m_resolution;
+        std::chrono::steady_clock::time_point const m_start;
+        impl::timer_wheel_node m_slots[level_count][slot_count];
+        uint64_t m_current{};
+        uint64_t m_wake{ no_deadline };
+        timer_wheel_metrics m_metrics;
+        slim_mutex m_lock;
+        slim_condition_variable m_condition;
+        std::thread m_thread;
+        bool m_stopping{};
+    };
+}
+
+#ifdef WINRT_TIMER_WHEEL
+namespace winrt::impl
+{
+    inline timer_wheel& get_timer_wheel()
+    {
+        // Intentionally leaked so that the timer thread is never joined during DLL unload.
+        static timer_wheel* wheel{ new timer_wheel() };
+        return *wheel;
+    }
+}
+#endif
+
+WINRT_EXPORT namespace winrt
+{
 
     [[nodiscard]] inline auto resume_after(Windows::Foundation::TimeSpan duration) noexcept
     {
+#ifdef WINRT_TIMER_WHEEL
+        return impl::get_timer_wheel().resume_after(duration);
+#else
         struct awaitable : enable_await_cancellation
         {
             explicit awaitable(Windows::Foundation::TimeSpan duration) noexcept :
@@ -506,6 +956,7 @@ WINRT_EXPORT namespace winrt
         };
 
         return awaitable{ duration };
+#endif
     }
 
 #ifdef WINRT_IMPL_COROUTINES
@@ -514,9 +965,526 @@ WINRT_EXPORT namespace winrt
         return resume_after(duration);
     }
 #endif
+}
+
+namespace winrt::impl
+{
+    struct wait_for_multiple_objects_backend
+    {
+        using handle_type = void*;
+
+        // MAXIMUM_WAIT_OBJECTS less the slot used to wake the waiting thread.
+        static constexpr uint32_t capacity{ 63 };
+        static constexpr uint32_t infinite{ 0xFFFFFFFF }; // INFINITE
+        static constexpr uint32_t signaled{ 0 }; // WAIT_OBJECT_0
+        static constexpr uint32_t timeout{ 258 }; // WAIT_TIMEOUT
+        static constexpr uint32_t failed{ 0xFFFFFFFF }; // WAIT_FAILED
+
+        wait_for_multiple_objects_backend() :
+            m_wake(check_pointer(WINRT_IMPL_CreateEventW(nullptr, false, false, nullptr)))
+        {
+        }
+
+        static bool ready(handle_type handle) noexcept
+        {
+            return WINRT_IMPL_WaitForSingleObject(handle, 0) == signaled;
+        }
+
+        void wake() noexcept
+        {
+            WINRT_VERIFY(WINRT_IMPL_SetEvent(m_wake.get()));
+        }
+
+        template <typename Callback>
+        void wait(handle_type const* handles, uint32_t const count, uint32_t const milliseconds, Callback&& callback) noexcept
+        {
+            handle_type all[capacity + 1];
+            all[0] = m_wake.get();
+            std::copy_n(handles, count, all + 1);
+
+            uint32_t const result = WINRT_IMPL_WaitForMultipleObjects(count + 1, all, false, milliseconds);
+            uint32_t first{};
+
+            if (result > 0 && result <= count) // WAIT_OBJECT_0 + n
+            {
+                first = result - 1;
+                callback(first++, signaled);
+            }
+            else if (result > 0x80 && result <= 0x80 + count) // WAIT_ABANDONED_0 + n
+            {
+                first = result - 0x81;
+                callback(first++, signaled);
+            }
+            else if (result != failed)
+            {
+                return;
+            }
+
+            // Only the first signaled handle is reported, so collect the rest of the batch without
+            // blocking. After a failure this also isolates the offending handle.
+            bool reported{ result != failed };
+
+            for (uint32_t index = first; index < count; ++index)
+            {
+                uint32_t const status = WINRT_IMPL_WaitForSingleObject(handles[index], 0);
+
+                if (status != timeout)
+                {
+                    callback(index, status == failed ? failed : signaled);
+                    reported = true;
+                }
+            }
+
+            // A failure that no single handle accounts for fails the whole batch rather than retrying it forever.
+            if (!reported)
+            {
+                for (uint32_t index = 0; index < count; ++index)
+                {
+                    callback(index, failed);
+                }
+            }
+        }
+
+    private:
+
+        handle m_wake;
+    };
+
+#if defined(WINRT_PORTABLE) && defined(__linux__) && defined(WINRT_WAIT_MULTIPLEXER)
+    // Stand-in for WaitForMultipleObjects on portable hosts. Handles are file descriptors, such as an eventfd,
+    // that are signaled while readable. The awaiting coroutine consumes the signal.
+    struct poll_backend
+    {
+        using handle_type = int;
+
+        static constexpr uint32_t capacity{ 255 };
+        static constexpr uint32_t infinite{ 0xFFFFFFFF };
+        static constexpr uint32_t signaled{ 0 };
+        static constexpr uint32_t timeout{ 258 };
+        static constexpr uint32_t failed{ 0xFFFFFFFF };
+
+        poll_backend() :
+            m_wake(::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK))
+        {
+            if (m_wake == -1)
+            {
+                throw_hresult(error_fail);
+            }
+        }
+
+        poll_backend(poll_backend const&) = delete;
+        poll_backend& operator=(poll_backend const&) = delete;
+
+        ~poll_backend()
+        {
+            ::close(m_wake);
+        }
+
+        static bool ready(handle_type handle) noexcept
+        {
+            pollfd descriptor{ handle, POLLIN, 0 };
+            return ::poll(&descriptor, 1, 0) == 1 && (descriptor.revents & POLLIN);
+        }
+
+        void wake() noexcept
+        {
+            uint64_t const value{ 1 };
+            [[maybe_unused]] auto const written = ::write(m_wake, &value, sizeof(value));
+        }
+
+        template <typename Callback>
+        void wait(handle_type const* handles, uint32_t const count, uint32_t const milliseconds, Callback&& callback) noexcept
+        {
+            pollfd descriptors[capacity + 1];
+            descriptors[0] = { m_wake, POLLIN, 0 };
+
+            for (uint32_t index = 0; index < count; ++index)
+            {
+                descriptors[index + 1] = { handles[index], POLLIN, 0 };
+            }
+
+            int const timeout_ms = milliseconds == infinite ? -1 : static_cast<int>((std::min)(milliseconds, uint32_t{ 0x7FFFFFFF }));
+
+            int const result = ::poll(descriptors, count + 1, timeout_ms);
+
+            if (result < 0 && errno != EINTR)
+            {
+                // Fail the whole batch rather than retrying it forever.
+                for (uint32_t index = 0; index < count; ++index)
+                {
+                    callback(index, failed);
+                }
+            }
+
+            if (result <= 0)
+            {
+                return;
+            }
+
+            if (descriptors[0].revents & POLLIN)
+            {
+                uint64_t value;
+                [[maybe_unused]] auto const consumed = ::read(m_wake, &value, sizeof(value));
+            }
+
+            for (uint32_t index = 0; index < count; ++index)
+            {
+                auto const events = descriptors[index + 1].revents;
+
+                if (events & (POLLERR | POLLNVAL))
+                {
+                    callback(index, failed);
+                }
+                else if (events & (POLLIN | POLLHUP))
+                {
+                    callback(index, signaled);
+                }
+            }
+        }
+
+    private:
+
+        int m_wake;
+    };
+
+#endif
+
+    enum class wait_state { idle, pending, canceled };
+
+    template <typename Backend>
+    struct wait_multiplexer_group;
+
+    template <typename Backend>
+    struct wait_multiplexer_entry
+    {
+        typename Backend::handle_type handle{};
+        std::chrono::steady_clock::time_point deadline{ (std::chrono::steady_clock::time_point::max)() };
+        wait_multiplexer_group<Backend>* group{};
+        uint32_t slot{};
+        uint32_t result{ Backend::signaled };
+        wait_multiplexer_entry* ready{};
+        coroutine_handle<> resume{ nullptr };
+        std::atomic<wait_state> state{ wait_state::idle };
+    };
+
+    template <typename Backend>
+    struct wait_multiplexer_group
+    {
+        Backend backend;
+        wait_multiplexer_entry<Backend>* slots[Backend::capacity]{};
+        uint32_t generations[Backend::capacity]{};
+        uint32_t count{};
+        bool dirty{};
+        std::thread thread;
+    };
+}
+
+WINRT_EXPORT namespace winrt
+{
+    template <typename Backend>
+    struct basic_wait_multiplexer
+    {
+        using handle_type = typename Backend::handle_type;
+
+        basic_wait_multiplexer() = default;
+        basic_wait_multiplexer(basic_wait_multiplexer const&) = delete;
+        basic_wait_multiplexer& operator=(basic_wait_multiplexer const&) = delete;
+
+        ~basic_wait_multiplexer()
+        {
+            {
+                slim_lock_guard const guard(m_lock);
+                m_stopping = true;
+
+                for (auto&& group : m_groups)
+                {
+                    WINRT_ASSERT(group->count == 0); // The multiplexer must outlive the coroutines awaiting it.
+                    group->backend.wake();
+                }
+            }
+
+            for (auto&& group : m_groups)
+            {
+                group->thread.join();
+            }
+        }
+
+        [[nodiscard]] auto resume_on_signal(handle_type handle, Windows::Foundation::TimeSpan timeout = {}) noexcept
+        {
+            struct awaitable : enable_await_cancellation, impl::wait_multiplexer_entry<Backend>
+            {
+                awaitable(basic_wait_multiplexer& multiplexer, handle_type handle, Windows::Foundation::TimeSpan timeout) noexcept :
+                    m_multiplexer(multiplexer),
+                    m_timeout(timeout)
+                {
+                    this->handle = handle;
+                }
+
+                void enable_cancellation(cancellable_promise* promise)
+                {
+                    promise->set_canceller([](void* context)
+                    {
+                        auto that = static_cast<awaitable*>(context);
+                        if (that->state.exchange(impl::wait_state::canceled, std::memory_order_acquire) == impl::wait_state::pending)
+                        {
+                            that->m_multiplexer.cancel(that);
+                        }
+                    }, this);
+                }
+
+                bool await_ready() const noexcept
+                {
+                    return Backend::ready(this->handle);
+                }
+
+                bool await_suspend(impl::coroutine_handle<> resume)
+                {
+                    this->resume = resume;
+                    return m_multiplexer.schedule(this, m_timeout);
+                }
+
+                bool await_resume()
+                {
+                    if (this->state.exchange(impl::wait_state::idle, std::memory_order_relaxed) == impl::wait_state::canceled)
+                    {
+                        throw hresult_canceled();
+                    }
+
+                    return this->result == Backend::signaled;
+                }
+
+            private:
+
+                basic_wait_multiplexer& m_multiplexer;
+                Windows::Foundation::TimeSpan m_timeout;
+            };
+
+            return awaitable{ *this, handle, timeout };
+        }
+
+    private:
+
+        using entry_type = impl::wait_multiplexer_entry<Backend>;
+        using group_type = impl::wait_multiplexer_group<Backend>;
+
+        bool schedule(entry_type* entry, Windows::Foundation::TimeSpan const timeout)
+        {
+            if (timeout.count() != 0)
+            {
+                entry->deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(timeout);
+            }
+
+            slim_lock_guard const guard(m_lock);
+            auto& group = acquire_group(entry->handle);
+
+            auto expected = impl::wait_state::idle;
+            if (!entry->state.compare_exchange_strong(expected, impl::wait_state::pending, std::memory_order_release))
+            {
+                // Canceled before it was scheduled, so don't suspend at all.
+                return false;
+            }
+
+            uint32_t slot{};
+
+            while (group.slots[slot])
+            {
+                ++slot;
+            }
+
+            group.slots[slot] = entry;
+            ++group.generations[slot];
+            ++group.count;
+            entry->group = &group;
+            entry->slot = slot;
+            refresh(group);
+            return true;
+        }
+
+        void cancel(entry_type* entry) noexcept
+        {
+            {
+                slim_lock_guard const guard(m_lock);
+                auto const group = entry->group;
+
+                if (group->slots[entry->slot] != entry)
+                {
+                    // Already signaled or timed out and its resumption is on its way.
+                    return;
+                }
+
+                remove(*group, entry->slot);
+                refresh(*group);
+            }
+
+            impl::resume_background_or_inline(entry->resume);
+        }
+
+        group_type& acquire_group(handle_type const handle)
+        {
+            // WaitForMultipleObjects rejects a batch that holds the same handle twice, and one wait would satisfy
+            // only one waiter on an auto-reset event anyway, so every waiter on a handle goes to a different group.
+            for (auto&& group : m_groups)
+            {
+                if (group->count < Backend::capacity && !holds(*group, handle))
+                {
+                    return *group;
+                }
+            }
+
+            m_groups.reserve(m_groups.size() + 1);
+            auto group = std::make_unique<group_type>();
+            group->thread = std::thread([this, &target = *group] { run(target); });
+            m_groups.push_back(std::move(group));
+            return *m_groups.back();
+        }
+
+        static bool holds(group_type const& group, handle_type const handle) noexcept
+        {
+            return std::any_of(std::begin(group.slots), std::end(group.slots), [handle](entry_type const* entry)
+            {
+                return entry && entry->handle == handle;
+            });
+        }
+
+        static void remove(group_type& group, uint32_t const slot) noexcept
+        {
+            group.slots[slot] = nullptr;
+            --group.count;
+        }
+
+        static void refresh(group_type& group) noexcept
+        {
+            // Any number of changes are picked up by a single pass of the waiting thread.
+            if (!group.dirty)
+            {
+                group.dirty = true;
+                group.backend.wake();
+            }
+        }
+
+        static uint32_t milliseconds_until(std::chrono::steady_clock::time_point const deadline) noexcept
+        {
+            if (deadline == (std::chrono::steady_clock::time_point::max)())
+            {
+                return Backend::infinite;
+            }
+
+            // Round up so that the wait doesn't return just short of the deadline and spin.
+            auto const remaining = std::chrono::ceil<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+            return static_cast<uint32_t>((std::clamp)(remaining, int64_t{}, int64_t{ Backend::infinite - 1 }));
+        }
+
+        void run(group_type& group) noexcept
+        {
+            handle_type handles[Backend::capacity];
+            uint32_t slots[Backend::capacity];
+            uint32_t generations[Backend::capacity];
+            uint32_t results[Backend::capacity];
+            m_lock.lock();
+
+            while (!m_stopping)
+            {
+                auto deadline = (std::chrono::steady_clock::time_point::max)();
+                uint32_t count{};
+                group.dirty = false;
+
+                for (uint32_t slot = 0; count < group.count; ++slot)
+                {
+                    if (auto const entry = group.slots[slot])
+                    {
+                        handles[count] = entry->handle;
+                        slots[count] = slot;
+                        generations[count] = group.generations[slot];
+                        results[count] = Backend::timeout;
+                        deadline = (std::min)(deadline, entry->deadline);
+                        ++count;
+                    }
+                }
+
+                m_lock.unlock();
+
+                group.backend.wait(handles, count, milliseconds_until(deadline), [&](uint32_t const index, uint32_t const status)
+                {
+                    results[index] = status;
+                });
+
+                auto const now = std::chrono::steady_clock::now();
+                entry_type* ready{};
+                m_lock.lock();
+
+                for (uint32_t index = 0; index < count; ++index)
+                {
+                    auto const slot = slots[index];
+                    auto const entry = group.slots[slot];
+
+                    // Skip slots that were canceled, and possibly reused, while waiting.
+                    if (!entry || group.generations[slot] != generations[index])
+                    {
+                        continue;
+                    }
+
+                    if (results[index] == Backend::timeout && entry->deadline > now)
+                    {
+                        continue;
+                    }
+
+                    entry->result = results[index];
+                    remove(group, slot);
+                    entry->ready = ready;
+                    ready = entry;
+                }
+
+                if (ready)
+                {
+                    m_lock.unlock();
+
+                    while (ready)
+                    {
+                        // The entry lives in the coroutine frame, so move on before resuming it.
+                        auto const resume = ready->resume;
+                        ready = ready->ready;
+                        impl::resume_background_or_inline(resume);
+                    }
+
+                    m_lock.lock();
+                }
+            }
+
+            m_lock.unlock();
+        }
+
+        slim_mutex m_lock;
+        std::vector<std::unique_ptr<group_type>> m_groups;
+        bool m_stopping{};
+    };
+
+    using wait_multiplexer = basic_wait_multiplexer<impl::wait_for_multiple_objects_backend>;
+
+#if defined(WINRT_PORTABLE) && defined(__linux__) && defined(WINRT_WAIT_MULTIPLEXER)
+    using poll_wait_multiplexer = basic_wait_multiplexer<impl::poll_backend>;
+#endif
+}
+
+#ifdef WINRT_WAIT_MULTIPLEXER
+namespace winrt::impl
+{
+    inline wait_multiplexer& get_wait_multiplexer()
+    {
+        // Intentionally leaked so that the wait threads are never joined during DLL unload.
+        static auto multiplexer{ new wait_multiplexer() };
+        return *multiplexer;
+    }
+}
+#endif
+
+WINRT_EXPORT namespace winrt
+{
 
     [[nodiscard]] inline auto resume_on_signal(void* handle, Windows::Foundation::TimeSpan timeout = {}) noexcept
     {
+#ifdef WINRT_WAIT_MULTIPLEXER
+        return impl::get_wait_multiplexer().resume_on_signal(handle, timeout);
+#else
         struct awaitable : enable_await_cancellation
         {
             awaitable(void* handle, Windows::Foundation::TimeSpan timeout) noexcept :
@@ -616,6 +1584,7 @@ WINRT_EXPORT namespace winrt
         };
 
         return awaitable{ handle, timeout };
+#endif
     }
 
     struct thread_pool
@@ -2,12 +2,19 @@
 WINRT_EXPORT namespace winrt
 {
 #ifdef WINRT_IMPL_COROUTINES
-    template<typename D>
+    template<typename D, typename Lock = slim_mutex>
     struct deferrable_event_args
     {
+#ifdef WINRT_LOCK_DIAGNOSTICS
+        deferrable_event_args()
+        {
+            impl::name_lock<D>(m_lock, L"winrt::deferrable_event_args");
+        }
+
+#endif
         Windows::Foundation::Deferral GetDeferral()
         {
-            slim_lock_guard const guard(m_lock);
+            impl::lock_guard const guard(m_lock);
 
             if (m_handle)
             {
@@ -43,7 +50,7 @@ WINRT_EXPORT namespace winrt
         {
             coroutine_handle resume = nullptr;
             {
-                slim_lock_guard const guard(m_lock);
+                impl::lock_guard const guard(m_lock);
 
                 if (m_outstanding_deferrals <= 0)
                 {
@@ -64,12 +71,12 @@ WINRT_EXPORT namespace winrt
 
         bool await_suspend(coroutine_handle handle) noexcept
         {
-            slim_lock_guard const guard(m_lock);
+            impl::lock_guard const guard(m_lock);
             m_handle = handle;
             return m_outstanding_deferrals > 0;
         }
 
-        slim_mutex m_lock;
+        Lock m_lock;
         int32_t m_outstanding_deferrals = 0;
         coroutine_handle m_handle = nullptr;
     };
@@ -185,25 +185,254 @@ namespace winrt::impl
 
 WINRT_EXPORT namespace winrt
 {
+    enum class origination_policy : uint8_t
+    {
+        full, // Originate error info when the error is constructed.
+        lazy, // Originate error info when the message or ABI result is first requested.
+        none, // Never originate error info.
+    };
+
+    struct origination_counters
+    {
+        uint64_t full;
+        uint64_t deferred;
+        uint64_t deferred_originated;
+        uint64_t suppressed;
+    };
+}
+
+namespace winrt::impl
+{
+    struct origination_settings
+    {
+        static constexpr uint32_t capacity{ 16 };
+
+        origination_policy find(int32_t const code) const noexcept
+        {
+            uint32_t const count = m_count.load(std::memory_order_acquire);
+
+            for (uint32_t index = 0; index < count; ++index)
+            {
+                uint64_t const entry = m_overrides[index].load(std::memory_order_relaxed);
+
+                if (static_cast<int32_t>(static_cast<uint32_t>(entry)) == code)
+                {
+                    return static_cast<origination_policy>(entry >> 32);
+                }
+            }
+
+            return static_cast<origination_policy>(m_default.load(std::memory_order_relaxed));
+        }
+
+        void set(origination_policy const policy) noexcept
+        {
+            m_default.store(static_cast<uint8_t>(policy), std::memory_order_relaxed);
+        }
+
+        bool set(int32_t const code, origination_policy const policy) noexcept
+        {
+            uint64_t const entry = (static_cast<uint64_t>(policy) << 32) | static_cast<uint32_t>(code);
+            slim_lock_guard const guard(m_lock);
+            uint32_t const count = m_count.load(std::memory_order_relaxed);
+
+            for (uint32_t index = 0; index < count; ++index)
+            {
+                if (static_cast<int32_t>(static_cast<uint32_t>(m_overrides[index].load(std::memory_order_relaxed))) == code)
+                {
+                    m_overrides[index].store(entry, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+
+            if (count == capacity)
+            {
+                return false;
+            }
+
+            m_overrides[count].store(entry, std::memory_order_relaxed);
+            m_count.store(count + 1, std::memory_order_release);
+            return true;
+        }
+
+        void clear() noexcept
+        {
+            slim_lock_guard const guard(m_lock);
+            m_count.store(0, std::memory_order_release);
+        }
+
+        origination_counters counters() const noexcept
+        {
+            return
+            {
+                full.load(std::memory_order_relaxed),
+                deferred.load(std::memory_order_relaxed),
+                deferred_originated.load(std::memory_order_relaxed),
+                suppressed.load(std::memory_order_relaxed)
+            };
+        }
+
+        std::atomic<uint64_t> full{};
+        std::atomic<uint64_t> deferred{};
+        std::atomic<uint64_t> deferred_originated{};
+        std::atomic<uint64_t> suppressed{};
+
+    private:
+
+        slim_mutex m_lock;
+        std::atomic<uint8_t> m_default{};
+        std::atomic<uint32_t> m_count{};
+        std::atomic<uint64_t> m_overrides[capacity]{};
+    };
+
+    inline origination_settings origination;
+
+    struct exception_translator_table
+    {
+        static constexpr uint32_t capacity{ 16 };
+
+        using translator_type = void(*)();
+        using thunk_type = int32_t(*)(std::exception_ptr const&, translator_type) noexcept;
+
+        bool add(thunk_type const thunk, translator_type const translator) noexcept
+        {
+            slim_lock_guard const guard(m_lock);
+            uint32_t const count = m_count.load(std::memory_order_relaxed);
+
+            if (count == capacity)
+            {
+                return false;
+            }
+
+            m_entries[count] = { thunk, translator };
+            m_count.store(count + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Must be called from within a catch block. Returns zero if no translator recognizes the exception.
+        int32_t translate() const noexcept
+        {
+            uint32_t const count = m_count.load(std::memory_order_acquire);
+
+            if (count == 0)
+            {
+                return 0;
+            }
+
+            // Captured once, since current_exception may copy the exception object.
+            auto const exception = std::current_exception();
+
+            for (uint32_t index = 0; index < count; ++index)
+            {
+                if (int32_t const result = m_entries[index].thunk(exception, m_entries[index].translator))
+                {
+                    return result;
+                }
+            }
+
+            return 0;
+        }
+
+    private:
+
+        struct entry
+        {
+            thunk_type thunk;
+            translator_type translator;
+        };
+
+        slim_mutex m_lock;
+        std::atomic<uint32_t> m_count{};
+        entry m_entries[capacity]{};
+    };
+
+    inline exception_translator_table exception_translators;
+
+    template <typename E>
+    int32_t translate_exception(std::exception_ptr const& exception, exception_translator_table::translator_type const translator) noexcept
+    {
+        try
+        {
+            std::rethrow_exception(exception);
+        }
+        catch (E const& e)
+        {
+            int32_t const result = reinterpret_cast<hresult(*)(E const&) noexcept>(translator)(e);
+            WINRT_ASSERT(result < 0);
+            return result;
+        }
+        catch (...)
+        {
+            return 0;
+        }
+    }
+}
+
+WINRT_EXPORT namespace winrt
+{
+    inline void set_origination_policy(origination_policy const policy) noexcept
+    {
+        impl::origination.set(policy);
+    }
+
+    // Overrides the policy for a specific error code. Returns false if the override table is full.
+    inline bool set_origination_policy(hresult const code, origination_policy const policy) noexcept
+    {
+        return impl::origination.set(code, policy);
+    }
+
+    inline void clear_origination_policy_overrides() noexcept
+    {
+        impl::origination.clear();
+    }
+
+    inline origination_policy get_origination_policy(hresult const code) noexcept
+    {
+        return impl::origination.find(code);
+    }
+
+    inline origination_counters get_origination_counters() noexcept
+    {
+        return impl::origination.counters();
+    }
+
     struct hresult_error
     {
         using from_abi_t = take_ownership_from_abi_t;
         static constexpr auto from_abi{ take_ownership_from_abi };
 
         hresult_error() noexcept = default;
-        hresult_error(hresult_error&&) = default;
-        hresult_error& operator=(hresult_error&&) = default;
+
+        hresult_error(hresult_error&& other) noexcept :
+            m_debug_reference(std::move(other.m_debug_reference)),
+            m_code(other.m_code),
+            m_info(std::move(other.m_info)),
+            m_message(std::move(other.m_message)),
+            m_policy(other.m_policy.load(std::memory_order_relaxed))
+        {
+        }
+
+        hresult_error& operator=(hresult_error&& other) noexcept
+        {
+            m_debug_reference = std::move(other.m_debug_reference);
+            m_code = other.m_code;
+            m_info = std::move(other.m_info);
+            m_message = std::move(other.m_message);
+            m_policy.store(other.m_policy.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            return *this;
+        }
 
         hresult_error(hresult_error const& other) noexcept :
             m_code(other.m_code),
-            m_info(other.m_info)
+            m_message(other.m_message)
         {
+            copy_origination(other);
         }
 
         hresult_error& operator=(hresult_error const& other) noexcept
         {
             m_code = other.m_code;
-            m_info = other.m_info;
+            m_message = other.m_message;
+            copy_origination(other);
             return *this;
         }
 
@@ -258,6 +487,8 @@ WINRT_EXPORT namespace winrt
 
         hstring message() const noexcept
         {
+            originate_deferred();
+
             if (m_info)
             {
                 int32_t code{};
@@ -281,21 +512,34 @@ WINRT_EXPORT namespace winrt
                 }
             }
 
+            if (!m_message.empty())
+            {
+                return m_message;
+            }
+
             return impl::message_from_hresult(m_code);
         }
 
         template <typename To>
         auto try_as() const noexcept
         {
+            originate_deferred();
             return m_info.try_as<To>();
         }
 
         hresult to_abi() const noexcept
         {
+            originate_deferred();
+
             if (m_info)
             {
                 WINRT_IMPL_SetErrorInfo(0, m_info.try_as<impl::IErrorInfo>().get());
             }
+            else if (m_policy.load(std::memory_order_relaxed) == origination_policy::none)
+            {
+                // Don't let stale error info on this thread describe this error.
+                WINRT_IMPL_SetErrorInfo(0, nullptr);
+            }
 
             return m_code;
         }
@@ -309,7 +553,76 @@ WINRT_EXPORT namespace winrt
             return 1;
         }
 
+        // Held by m_policy while a lazy error is being originated.
+        static constexpr origination_policy originating{ 3 };
+
         void originate(hresult const code, void* message) noexcept
+        {
+            auto const policy = impl::origination.find(code);
+            m_policy.store(policy, std::memory_order_relaxed);
+
+            if (policy == origination_policy::full)
+            {
+                impl::origination.full.fetch_add(1, std::memory_order_relaxed);
+                originate_now(code, message);
+                return;
+            }
+
+            if (message)
+            {
+                m_message = *reinterpret_cast<hstring const*>(&message);
+            }
+
+            if (policy == origination_policy::lazy)
+            {
+                impl::origination.deferred.fetch_add(1, std::memory_order_relaxed);
+            }
+            else
+            {
+                impl::origination.suppressed.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        // A thrown error may be observed by several threads at once, for example when each awaiter of an async
+        // operation rethrows its stored exception_ptr. Only one of them originates a lazy error and the rest wait
+        // for m_info, which is never changed once the policy is no longer lazy.
+        void originate_deferred() const noexcept
+        {
+            auto policy = origination_policy::lazy;
+
+            if (m_policy.compare_exchange_strong(policy, originating, std::memory_order_acquire))
+            {
+                impl::origination.deferred_originated.fetch_add(1, std::memory_order_relaxed);
+                originate_now(m_code, get_abi(m_message));
+                m_policy.store(origination_policy::full, std::memory_order_release);
+                return;
+            }
+
+            settled_policy();
+        }
+
+        origination_policy settled_policy() const noexcept
+        {
+            auto policy = m_policy.load(std::memory_order_acquire);
+
+            while (policy == originating)
+            {
+                std::this_thread::yield();
+                policy = m_policy.load(std::memory_order_acquire);
+            }
+
+            return policy;
+        }
+
+        // A copy of a lazy error stays lazy, so m_info is only read once it can no longer change.
+        void copy_origination(hresult_error const& other) noexcept
+        {
+            auto const policy = other.settled_policy();
+            m_info = policy == origination_policy::lazy ? nullptr : other.m_info;
+            m_policy.store(policy, std::memory_order_relaxed);
+        }
+
+        void originate_now(hresult const code, void* message) const noexcept
         {
             static int32_t(__stdcall* handler)(int32_t error, void* message, void* exception) noexcept;
             impl::load_runtime_function(L"combase.dll", "RoOriginateLanguageException", handler, fallback_RoOriginateLanguageException);
@@ -335,7 +648,9 @@ WINRT_EXPORT namespace winrt
         impl::bstr_handle m_debug_reference;
         uint32_t m_debug_magic{ 0xAABBCCDD };
         hresult m_code{ impl::error_fail };
-        com_ptr<impl::IRestrictedErrorInfo> m_info;
+        mutable com_ptr<impl::IRestrictedErrorInfo> m_info;
+        hstring m_message;
+        mutable std::atomic<origination_policy> m_policy{ origination_policy::full };
 
 #ifdef __clang__
 #pragma clang diagnostic pop
@@ -513,6 +828,15 @@ WINRT_EXPORT namespace winrt
         throw hresult_error(result, take_ownership_from_abi);
     }
 
+    // Translators run in the order they were added, after hresult_error and before the standard exception types,
+    // and the first to match the exception's type decides the result. They must not throw and must return a failure.
+    // Add them at startup, before any exceptions are translated. Returns false if the table is full.
+    template <typename E>
+    bool add_exception_translator(hresult(*translator)(E const&) noexcept) noexcept
+    {
+        return impl::exception_translators.add(impl::translate_exception<E>, reinterpret_cast<impl::exception_translator_table::translator_type>(translator));
+    }
+
     inline WINRT_IMPL_NOINLINE hresult to_hresult() noexcept
     {
         if (winrt_to_hresult_handler)
@@ -520,6 +844,29 @@ WINRT_EXPORT namespace winrt
             return winrt_to_hresult_handler(WINRT_IMPL_RETURNADDRESS());
         }
 
+        // The exception is only rethrown once here. Any other than hresult_error is offered to the translators,
+        // which each rethrow it into a catch for their own type, and otherwise falls back to the code given.
+        auto const translate = [](hresult const code, char const* const what) noexcept
+        {
+            if (hresult const result = impl::exception_translators.translate())
+            {
+                return result;
+            }
+
+            if (!what)
+            {
+                return code;
+            }
+
+            // The message is only converted if error info will actually be published.
+            if (impl::origination.find(code) == origination_policy::none)
+            {
+                return hresult_error(code).to_abi();
+            }
+
+            return hresult_error(code, to_hstring(what)).to_abi();
+        };
+
         try
         {
             throw;
@@ -530,19 +877,28 @@ WINRT_EXPORT namespace winrt
         }
         catch (std::bad_alloc const&)
         {
-            return impl::error_bad_alloc;
+            return translate(impl::error_bad_alloc, nullptr);
         }
         catch (std::out_of_range const& e)
         {
-            return hresult_out_of_bounds(to_hstring(e.what())).to_abi();
+            return translate(impl::error_out_of_bounds, e.what());
         }
         catch (std::invalid_argument const& e)
         {
-            return hresult_invalid_argument(to_hstring(e.what())).to_abi();
+            return translate(impl::error_invalid_argument, e.what());
         }
         catch (std::exception const& e)
         {
-            return hresult_error(impl::error_fail, to_hstring(e.what())).to_abi();
+            return translate(impl::error_fail, e.what());
+        }
+        catch (...)
+        {
+            if (hresult const result = impl::exception_translators.translate())
+            {
+                return result;
+            }
+
+            abort();
         }
     }
 
@@ -567,6 +923,11 @@ WINRT_EXPORT namespace winrt
         }
         catch (...)
         {
+            if (hresult const result = impl::exception_translators.translate())
+            {
+                return impl::message_from_hresult(result);
+            }
+
             abort();
         }
     }
@@ -331,7 +331,9 @@ namespace winrt::impl
     com_ptr<event_array<T>> make_event_array(uint32_t const capacity)
     {
         void* raw = ::operator new(sizeof(event_array<T>) + (sizeof(T)* capacity));
+#ifdef _MSC_VER
 #pragma warning(suppress: 6386)
+#endif
         return { new(raw) event_array<T>(capacity), take_ownership_from_abi };
     }
 
@@ -369,12 +371,20 @@ namespace winrt::impl
 
 WINRT_EXPORT namespace winrt
 {
-    template <typename Delegate>
+    template <typename Delegate, typename Lock = slim_mutex>
     struct event
     {
         using delegate_type = Delegate;
 
+#ifdef WINRT_LOCK_DIAGNOSTICS
+        event()
+        {
+            impl::name_lock<Delegate>(m_change, L"winrt::event");
+            impl::name_lock<Delegate>(m_swap, L"winrt::event");
+        }
+#else
         event() = default;
+#endif
         event(event const&) = delete;
         event& operator =(event const&) = delete;
 
@@ -391,7 +401,7 @@ WINRT_EXPORT namespace winrt
             delegate_array temp_targets;
 
             {
-                slim_lock_guard const change_guard(m_change);
+                impl::lock_guard const change_guard(m_change);
                 delegate_array new_targets = impl::make_event_array<delegate_type>((!m_targets) ? 1 : m_targets->size() + 1);
 
                 if (m_targets)
@@ -402,7 +412,7 @@ WINRT_EXPORT namespace winrt
                 new_targets->back() = impl::make_agile_delegate(delegate);
                 token = get_token(new_targets->back());
 
-                slim_lock_guard const swap_guard(m_swap);
+                impl::lock_guard const swap_guard(m_swap);
                 temp_targets = std::exchange(m_targets, std::move(new_targets));
             }
 
@@ -415,7 +425,7 @@ WINRT_EXPORT namespace winrt
             delegate_array temp_targets;
 
             {
-                slim_lock_guard const change_guard(m_change);
+                impl::lock_guard const change_guard(m_change);
 
                 if (!m_targets)
                 {
@@ -460,7 +470,7 @@ WINRT_EXPORT namespace winrt
 
                 if (removed)
                 {
-                    slim_lock_guard const swap_guard(m_swap);
+                    impl::lock_guard const swap_guard(m_swap);
                     temp_targets = std::exchange(m_targets, std::move(new_targets));
                 }
             }
@@ -472,14 +482,14 @@ WINRT_EXPORT namespace winrt
             delegate_array temp_targets;
 
             {
-                slim_lock_guard const change_guard(m_change);
+                impl::lock_guard const change_guard(m_change);
 
                 if (!m_targets)
                 {
                     return;
                 }
 
-                slim_lock_guard const swap_guard(m_swap);
+                impl::lock_guard const swap_guard(m_swap);
                 temp_targets = std::exchange(m_targets, nullptr);
             }
         }
@@ -490,7 +500,7 @@ WINRT_EXPORT namespace winrt
             delegate_array temp_targets;
 
             {
-                slim_lock_guard const swap_guard(m_swap);
+                impl::lock_guard const swap_guard(m_swap);
                 temp_targets = m_targets;
             }
 
@@ -516,7 +526,7 @@ WINRT_EXPORT namespace winrt
         using delegate_array = com_ptr<impl::event_array<delegate_type>>;
 
         delegate_array m_targets;
-        slim_mutex m_swap;
-        slim_mutex m_change;
+        Lock m_swap;
+        Lock m_change;
     };
 }
@@ -55,6 +55,8 @@ extern "C"
     int32_t __stdcall WINRT_IMPL_SleepConditionVariableSRW(winrt::impl::condition_variable* cv, winrt::impl::srwlock* lock, uint32_t milliseconds, uint32_t flags) noexcept;
     void    __stdcall WINRT_IMPL_WakeConditionVariable(winrt::impl::condition_variable* cv) noexcept;
     void    __stdcall WINRT_IMPL_WakeAllConditionVariable(winrt::impl::condition_variable* cv) noexcept;
+    int32_t __stdcall WINRT_IMPL_WaitOnAddress(void volatile* address, void* compare, std::size_t size, uint32_t milliseconds) noexcept;
+    void    __stdcall WINRT_IMPL_WakeByAddressAll(void* address) noexcept;
     void*   __stdcall WINRT_IMPL_InterlockedPushEntrySList(void* head, void* entry) noexcept;
     void*   __stdcall WINRT_IMPL_InterlockedFlushSList(void* head) noexcept;
 
@@ -62,6 +64,7 @@ extern "C"
     int32_t __stdcall WINRT_IMPL_SetEvent(void*) noexcept;
     int32_t  __stdcall WINRT_IMPL_CloseHandle(void* hObject) noexcept;
     uint32_t __stdcall WINRT_IMPL_WaitForSingleObject(void* handle, uint32_t milliseconds) noexcept;
+    uint32_t __stdcall WINRT_IMPL_WaitForMultipleObjects(uint32_t count, void* const* handles, int32_t wait_all, uint32_t milliseconds) noexcept;
 
     int32_t  __stdcall WINRT_IMPL_TrySubmitThreadpoolCallback(void(__stdcall *callback)(void*, void* context), void* context, void*) noexcept;
     winrt::impl::ptp_timer __stdcall WINRT_IMPL_CreateThreadpoolTimer(void(__stdcall *callback)(void*, void* context, void*), void* context, void*) noexcept;
@@ -83,6 +86,8 @@ extern "C"
     int32_t __stdcall WINRT_GetActivationFactory(void* classId, void** factory) noexcept;
 }
 
+#ifndef WINRT_PORTABLE
+
 #ifdef _M_HYBRID
 #define WINRT_IMPL_LINK(function, count) __pragma(comment(linker, "/alternatename:#WINRT_IMPL_" #function "@" #count "=#" #function "@" #count))
 #elif _M_ARM64EC
@@ -139,6 +144,8 @@ WINRT_IMPL_LINK(ReleaseSRWLockShared, 4)
 WINRT_IMPL_LINK(SleepConditionVariableSRW, 16)
 WINRT_IMPL_LINK(WakeConditionVariable, 4)
 WINRT_IMPL_LINK(WakeAllConditionVariable, 4)
+WINRT_IMPL_LINK(WaitOnAddress, 16)
+WINRT_IMPL_LINK(WakeByAddressAll, 4)
 WINRT_IMPL_LINK(InterlockedPushEntrySList, 8)
 WINRT_IMPL_LINK(InterlockedFlushSList, 4)
 
@@ -146,6 +153,7 @@ WINRT_IMPL_LINK(CreateEventW, 16)
 WINRT_IMPL_LINK(SetEvent, 4)
 WINRT_IMPL_LINK(CloseHandle, 4)
 WINRT_IMPL_LINK(WaitForSingleObject, 8)
+WINRT_IMPL_LINK(WaitForMultipleObjects, 16)
 
 WINRT_IMPL_LINK(TrySubmitThreadpoolCallback, 12)
 WINRT_IMPL_LINK(CreateThreadpoolTimer, 12)
@@ -164,3 +172,5 @@ WINRT_IMPL_LINK(SetThreadpoolThreadMinimum, 8)
 WINRT_IMPL_LINK(CloseThreadpool, 4)
 
 #undef WINRT_IMPL_LINK
+
+#endif
@@ -453,7 +453,9 @@ namespace winrt::impl
     template <typename T>
     struct pinterface_guid
     {
+#ifdef _MSC_VER
 #pragma warning(suppress: 4307)
+#endif
         static constexpr guid value{ generate_guid(signature<T>::data) };
     };
 
@@ -461,7 +463,9 @@ namespace winrt::impl
 #ifdef __clang__
     inline static const auto name_v
 #else
+#ifdef _MSC_VER
 #pragma warning(suppress: 4307)
+#endif
     inline constexpr auto name_v
 #endif
     {
@@ -32,17 +32,25 @@ WINRT_EXPORT namespace winrt
 
 namespace winrt::impl
 {
-    template<typename...T>
-    using tuple_cat_t = decltype(std::tuple_cat(std::declval<T>()...));
+    template <typename...> struct interface_list;
 
-    template <template <typename> typename Condition, typename>
-    struct tuple_if_base;
+    template <>
+    struct interface_list<>
+    {
+        template <typename T, typename Predicate>
+        static constexpr void* find(const T*, const Predicate&) noexcept
+        {
+            return nullptr;
+        }
+    };
 
-    template <template <typename> typename Condition, typename...T>
-    struct tuple_if_base<Condition, std::tuple<T...>> { using type = tuple_cat_t<typename std::conditional<Condition<T>::value, std::tuple<T>, std::tuple<>>::type...>; };
+    // Interface lists are built by folding over this operator, so that filtering a pack costs one overload resolution
+    // per element rather than a chain of nested class templates that each append one more element.
+    template <typename... T, typename... U>
+    interface_list<T..., U...> operator+(interface_list<T...>, interface_list<U...>);
 
-    template <template <typename> typename Condition, typename T>
-    using tuple_if = typename tuple_if_base<Condition, T>::type;
+    template <template <typename> typename Condition, typename... T>
+    using interface_list_if = decltype((interface_list<>{} + ... + std::conditional_t<Condition<T>::value, interface_list<T>, interface_list<>>{}));
 
     template <typename T>
     struct is_interface : std::disjunction<std::is_base_of<Windows::Foundation::IInspectable, T>, is_classic_com_interface<T>> {};
@@ -122,10 +130,10 @@ namespace winrt::impl
     };
 
     template <typename D, typename...T>
-    struct producers_base<D, std::tuple<T...>> : producer_convert<D, T>... {};
+    struct producers_base<D, interface_list<T...>> : producer_convert<D, T>... {};
 
     template <typename D, typename...T>
-    using producers = producers_base<D, tuple_if<is_interface, std::tuple<uncloak<T>...>>>;
+    using producers = producers_base<D, interface_list_if<is_interface, uncloak<T>...>>;
 
     template <typename D, typename... I>
     struct root_implements;
@@ -145,29 +153,39 @@ namespace winrt::impl
     template <typename T>
     using unwrap_implements_t = typename unwrap_implements<T>::type;
 
-    template <typename...>
-    struct nested_implements
+    template <typename... I>
+    constexpr size_t nested_implements_index() noexcept
+    {
+        constexpr bool found[]{ is_implements_v<I>..., true };
+        size_t index{};
+
+        while (!found[index])
+        {
+            ++index;
+        }
+
+        return index;
+    }
+
+    template <bool Found, typename... I>
+    struct nested_implements_base
     {};
 
-    template <typename First, typename... Rest>
-    struct nested_implements<First, Rest...>
-        : std::conditional_t<is_implements_v<First>,
-        impl::identity<First>, nested_implements<Rest...>>
+    template <typename... I>
+    struct nested_implements_base<true, I...>
+        : impl::identity<pack_element<nested_implements_index<I...>(), I...>>
     {
-        static_assert(!is_implements_v<First> || !std::disjunction_v<is_implements<Rest>...>,
-            "Duplicate nested implements found");
+        static_assert((size_t{ is_implements_v<I> } + ... + 0) == 1, "Duplicate nested implements found");
     };
 
-    template <typename D, typename Dummy = std::void_t<>, typename... I>
-    struct base_implements_impl
-        : impl::identity<root_implements<D, I...>> {};
-
-    template <typename D, typename... I>
-    struct base_implements_impl<D, std::void_t<typename nested_implements<I...>::type>, I...>
-        : nested_implements<I...> {};
+    template <typename... I>
+    struct nested_implements
+        : nested_implements_base<(is_implements_v<I> || ...), I...>
+    {};
 
     template <typename D, typename... I>
-    using base_implements = base_implements_impl<D, void, I...>;
+    using base_implements = std::conditional_t<(is_implements_v<I> || ...),
+        nested_implements<I...>, impl::identity<root_implements<D, I...>>>;
 
     template <typename T, typename = std::void_t<>>
     struct has_composable : std::false_type {};
@@ -248,82 +266,41 @@ WINRT_EXPORT namespace winrt
 
 namespace winrt::impl
 {
-    template <typename...> struct interface_list;
-
-    template <>
-    struct interface_list<>
-    {
-        template <typename T, typename Predicate>
-        static constexpr void* find(const T*, const Predicate&) noexcept
-        {
-            return nullptr;
-        }
-    };
-
     template <typename First, typename ... Rest>
     struct interface_list<First, Rest...>
     {
         template <typename T, typename Predicate>
         static constexpr void* find(const T* obj, const Predicate& pred) noexcept
         {
-            if (pred.template test<First>())
-            {
-                return to_abi<First>(obj);
-            }
-            return interface_list<Rest...>::find(obj, pred);
+            void* result = nullptr;
+            static_cast<void>(((pred.template test<First>() && (result = to_abi<First>(obj), true)) ||
+                ... || (pred.template test<Rest>() && (result = to_abi<Rest>(obj), true))));
+            return result;
         }
         using first_interface = First;
     };
 
-    template <typename, typename> struct interface_list_append_impl;
-
-    template <typename... T, typename... U>
-    struct interface_list_append_impl<interface_list<T...>, interface_list<U...>>
+    // Maps a single element to the interfaces it contributes: itself if it satisfies the predicate, or the filtered
+    // interfaces of a nested list or implements. Only nesting recurses; the elements of a pack are folded.
+    template <template <typename> class Predicate, typename T>
+    struct filter_impl
     {
-        using type = interface_list<T..., U...>;
+        using type = std::conditional_t<Predicate<T>::value, interface_list<winrt::impl::uncloak<T>>, interface_list<>>;
     };
 
-    template <template <typename> class, typename...>
-    struct filter_impl;
-
     template <template <typename> class Predicate, typename... T>
-    using filter = typename filter_impl<Predicate, unwrap_implements_t<T>...>::type;
-
-    template <template <typename> class Predicate>
-    struct filter_impl<Predicate>
-    {
-        using type = interface_list<>;
-    };
-
-    template <template <typename> class Predicate, typename T, typename... Rest>
-    struct filter_impl<Predicate, T, Rest...>
-    {
-        using type = typename interface_list_append_impl<
-            std::conditional_t<
-            Predicate<T>::value,
-            interface_list<winrt::impl::uncloak<T>>,
-            interface_list<>
-            >,
-            typename filter_impl<Predicate, Rest...>::type
-        >::type;
-    };
+    using filter = decltype((interface_list<>{} + ... + typename filter_impl<Predicate, unwrap_implements_t<T>>::type{}));
 
-    template <template <typename> class Predicate, typename ... T, typename ... Rest>
-    struct filter_impl<Predicate, interface_list<T...>, Rest...>
+    template <template <typename> class Predicate, typename ... T>
+    struct filter_impl<Predicate, interface_list<T...>>
     {
-        using type = typename interface_list_append_impl<
-            filter<Predicate, T...>,
-            filter<Predicate, Rest...>
-        >::type;
+        using type = filter<Predicate, T...>;
     };
 
-    template <template <typename> class Predicate, typename D, typename ... I, typename ... Rest>
-    struct filter_impl<Predicate, winrt::implements<D, I...>, Rest...>
+    template <template <typename> class Predicate, typename D, typename ... I>
+    struct filter_impl<Predicate, winrt::implements<D, I...>>
     {
-        using type = typename interface_list_append_impl<
-            filter<Predicate, I...>,
-            filter<Predicate, Rest...>
-        >::type;
+        using type = filter<Predicate, I...>;
     };
 
     template <typename T>
@@ -340,7 +317,9 @@ namespace winrt::impl
     template <typename ... T>
     struct uncloaked_iids<interface_list<T...>>
     {
+#ifdef _MSC_VER
 #pragma warning(suppress: 4307)
+#endif
         static constexpr std::array<guid, sizeof...(T)> value{ winrt::guid_of<T>() ... };
     };
 
@@ -724,6 +703,7 @@ namespace winrt::impl
     struct __declspec(empty_bases) root_implements_composable_inner
     {
     protected:
+        static constexpr bool is_composable = false;
         static constexpr inspectable_abi* outer() noexcept { return nullptr; }
 
         template <typename, typename, typename>
@@ -734,6 +714,7 @@ namespace winrt::impl
     struct __declspec(empty_bases) root_implements_composable_inner<D, true> : producer<D, INonDelegatingInspectable>
     {
     protected:
+        static constexpr bool is_composable = true;
         inspectable_abi* outer() noexcept { return m_outer; }
     private:
         inspectable_abi* m_outer = nullptr;
@@ -756,9 +737,12 @@ namespace winrt::impl
 
         int32_t __stdcall QueryInterface(guid const& id, void** object) noexcept
         {
-            if (this->outer())
+            if constexpr (root_implements_type::is_composable)
             {
-                return this->outer()->QueryInterface(id, object);
+                if (this->outer())
+                {
+                    return this->outer()->QueryInterface(id, object);
+                }
             }
 
             int32_t result = query_interface(id, object);
@@ -773,9 +757,12 @@ namespace winrt::impl
 
         uint32_t __stdcall AddRef() noexcept
         {
-            if (this->outer())
+            if constexpr (root_implements_type::is_composable)
             {
-                return this->outer()->AddRef();
+                if (this->outer())
+                {
+                    return this->outer()->AddRef();
+                }
             }
 
             return NonDelegatingAddRef();
@@ -783,9 +770,12 @@ namespace winrt::impl
 
         uint32_t __stdcall Release() noexcept
         {
-            if (this->outer())
+            if constexpr (root_implements_type::is_composable)
             {
-                return this->outer()->Release();
+                if (this->outer())
+                {
+                    return this->outer()->Release();
+                }
             }
 
             return NonDelegatingRelease();
@@ -836,9 +826,12 @@ namespace winrt::impl
 
         int32_t __stdcall GetIids(uint32_t* count, guid** array) noexcept
         {
-            if (this->outer())
+            if constexpr (root_implements_type::is_composable)
             {
-                return this->outer()->GetIids(count, array);
+                if (this->outer())
+                {
+                    return this->outer()->GetIids(count, array);
+                }
             }
 
             return NonDelegatingGetIids(count, array);
@@ -846,9 +839,12 @@ namespace winrt::impl
 
         int32_t __stdcall abi_GetRuntimeClassName(void** name) noexcept
         {
-            if (this->outer())
+            if constexpr (root_implements_type::is_composable)
             {
-                return this->outer()->GetRuntimeClassName(name);
+                if (this->outer())
+                {
+                    return this->outer()->GetRuntimeClassName(name);
+                }
             }
 
             return NonDelegatingGetRuntimeClassName(name);
@@ -856,9 +852,12 @@ namespace winrt::impl
 
         int32_t __stdcall abi_GetTrustLevel(Windows::Foundation::TrustLevel* trustLevel) noexcept
         {
-            if (this->outer())
+            if constexpr (root_implements_type::is_composable)
             {
-                return this->outer()->GetTrustLevel(trustLevel);
+                if (this->outer())
+                {
+                    return this->outer()->GetTrustLevel(trustLevel);
+                }
             }
 
             return NonDelegatingGetTrustLevel(trustLevel);
@@ -940,13 +939,12 @@ namespace winrt::impl
                 {
                     const com_array<guid>& inner_iids = get_interfaces(root_implements_type::m_inner);
                     *count = local_count + inner_iids.size();
-                    *array = static_cast<guid*>(WINRT_IMPL_CoTaskMemAlloc(sizeof(guid)*(*count)));
+                    *array = static_cast<guid*>(array_allocate(sizeof(guid)*(*count)));
                     if (*array == nullptr)
                     {
                         return error_bad_alloc;
                     }
-                    *array = std::copy(local_iids.second, local_iids.second + local_count, *array);
-                    std::copy(inner_iids.cbegin(), inner_iids.cend(), *array);
+                    std::copy(inner_iids.cbegin(), inner_iids.cend(), std::copy(local_iids.second, local_iids.second + local_count, *array));
                 }
                 else
                 {
@@ -958,7 +956,7 @@ namespace winrt::impl
                 if (local_count > 0)
                 {
                     *count = local_count;
-                    *array = static_cast<guid*>(WINRT_IMPL_CoTaskMemAlloc(sizeof(guid)*(*count)));
+                    *array = static_cast<guid*>(array_allocate(sizeof(guid)*(*count)));
                     if (*array == nullptr)
                     {
                         return error_bad_alloc;
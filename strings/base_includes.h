@@ -1,11 +1,19 @@
 
+#if !defined(_WIN32) && !defined(WINRT_PORTABLE)
+#define WINRT_PORTABLE
+#endif
+
 #include <algorithm>
 #include <array>
 #include <atomic>
 #include <charconv>
 #include <chrono>
 #include <cstddef>
+#include <cstring>
+#include <cwchar>
+#include <cwctype>
 #include <iterator>
+#include <limits>
 #include <map>
 #include <memory>
 #include <optional>
@@ -28,6 +36,27 @@
 #include <format>
 #endif
 
+#ifndef _WIN32
+#include <cassert>
+#endif
+
+// The futex backs address waits in the portable backend, while poll and eventfd are only needed by the
+// wait_multiplexer backend that WINRT_WAIT_MULTIPLEXER opts into.
+#if defined(WINRT_PORTABLE) && defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#ifdef WINRT_WAIT_MULTIPLEXER
+#include <cerrno>
+#include <poll.h>
+#include <sys/eventfd.h>
+#endif
+#endif
+
+#if __has_include(<version>)
+#include <version>
+#endif
+
 #ifdef __cpp_lib_coroutine
 
 #include <coroutine>
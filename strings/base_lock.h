@@ -1,4 +1,248 @@
 
+#ifdef WINRT_LOCK_DIAGNOSTICS
+
+namespace winrt::impl
+{
+    inline constexpr uint32_t lock_histogram_size{ 16 };
+
+    // Times are in nanoseconds. Histogram bucket zero counts times under 256ns, and each bucket after that
+    // doubles, so the last bucket counts anything from about 4ms up.
+    struct lock_diagnostics_info
+    {
+        uint64_t acquisitions{};
+        uint64_t contentions{};
+        uint64_t wait_time{};
+        uint64_t hold_time{};
+        std::array<uint64_t, lock_histogram_size> wait_histogram{};
+        std::array<uint64_t, lock_histogram_size> hold_histogram{};
+    };
+
+    inline uint64_t lock_clock() noexcept
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    struct lock_site
+    {
+        void acquired() noexcept
+        {
+            m_acquisitions.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void waited(uint64_t const time) noexcept
+        {
+            m_contentions.fetch_add(1, std::memory_order_relaxed);
+            m_wait_time.fetch_add(time, std::memory_order_relaxed);
+            m_wait_histogram[bucket(time)].fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void held(uint64_t const time) noexcept
+        {
+            m_hold_time.fetch_add(time, std::memory_order_relaxed);
+            m_hold_histogram[bucket(time)].fetch_add(1, std::memory_order_relaxed);
+        }
+
+        lock_diagnostics_info get() const noexcept
+        {
+            lock_diagnostics_info info;
+            info.acquisitions = m_acquisitions.load(std::memory_order_relaxed);
+            info.contentions = m_contentions.load(std::memory_order_relaxed);
+            info.wait_time = m_wait_time.load(std::memory_order_relaxed);
+            info.hold_time = m_hold_time.load(std::memory_order_relaxed);
+
+            for (uint32_t index = 0; index < lock_histogram_size; ++index)
+            {
+                info.wait_histogram[index] = m_wait_histogram[index].load(std::memory_order_relaxed);
+                info.hold_histogram[index] = m_hold_histogram[index].load(std::memory_order_relaxed);
+            }
+
+            return info;
+        }
+
+        void reset() noexcept
+        {
+            m_acquisitions.store(0, std::memory_order_relaxed);
+            m_contentions.store(0, std::memory_order_relaxed);
+            m_wait_time.store(0, std::memory_order_relaxed);
+            m_hold_time.store(0, std::memory_order_relaxed);
+
+            for (uint32_t index = 0; index < lock_histogram_size; ++index)
+            {
+                m_wait_histogram[index].store(0, std::memory_order_relaxed);
+                m_hold_histogram[index].store(0, std::memory_order_relaxed);
+            }
+        }
+
+    private:
+
+        static uint32_t bucket(uint64_t time) noexcept
+        {
+            uint32_t index{};
+
+            for (time >>= 8; time && index < lock_histogram_size - 1; time >>= 1)
+            {
+                ++index;
+            }
+
+            return index;
+        }
+
+        std::atomic<uint64_t> m_acquisitions{};
+        std::atomic<uint64_t> m_contentions{};
+        std::atomic<uint64_t> m_wait_time{};
+        std::atomic<uint64_t> m_hold_time{};
+        std::atomic<uint64_t> m_wait_histogram[lock_histogram_size]{};
+        std::atomic<uint64_t> m_hold_histogram[lock_histogram_size]{};
+    };
+
+    // The registry guards itself with a raw SRW lock so that it doesn't show up in its own statistics.
+    struct lock_diagnostics_cache
+    {
+        // The name must outlive the cache, as the names returned by name_of do.
+        lock_site& site(std::wstring_view const name)
+        {
+            guard const lock(m_lock);
+            return m_sites[name];
+        }
+
+        lock_site& unattributed() noexcept
+        {
+            return m_unattributed;
+        }
+
+        std::map<std::wstring_view, lock_diagnostics_info> get()
+        {
+            std::map<std::wstring_view, lock_diagnostics_info> result;
+            guard const lock(m_lock);
+
+            for (auto&& [name, site] : m_sites)
+            {
+                result.emplace(name, site.get());
+            }
+
+            result.emplace(L"(unattributed)", m_unattributed.get());
+            return result;
+        }
+
+        auto detach()
+        {
+            auto result = get();
+            guard const lock(m_lock);
+
+            for (auto&& [name, site] : m_sites)
+            {
+                site.reset();
+            }
+
+            m_unattributed.reset();
+            return result;
+        }
+
+        // Formats one line per site, most contended first.
+        std::wstring dump()
+        {
+            auto const info = get();
+            std::vector<std::pair<std::wstring_view, lock_diagnostics_info const*>> sites;
+
+            for (auto&& [name, site] : info)
+            {
+                if (site.acquisitions)
+                {
+                    sites.emplace_back(name, &site);
+                }
+            }
+
+            std::sort(sites.begin(), sites.end(), [](auto&& left, auto&& right)
+            {
+                return left.second->wait_time > right.second->wait_time;
+            });
+
+            std::wstring result;
+
+            for (auto&& [name, site] : sites)
+            {
+                result += name;
+                result += L": acquisitions=" + std::to_wstring(site->acquisitions);
+                result += L" contentions=" + std::to_wstring(site->contentions);
+                result += L" wait_ns=" + std::to_wstring(site->wait_time);
+                result += L" hold_ns=" + std::to_wstring(site->hold_time);
+                append_histogram(result, L" wait=", site->wait_histogram);
+                append_histogram(result, L" hold=", site->hold_histogram);
+                result += L'\n';
+            }
+
+            return result;
+        }
+
+    private:
+
+        struct guard
+        {
+            explicit guard(srwlock& lock) noexcept : m_lock(lock)
+            {
+                WINRT_IMPL_AcquireSRWLockExclusive(&m_lock);
+            }
+
+            ~guard() noexcept
+            {
+                WINRT_IMPL_ReleaseSRWLockExclusive(&m_lock);
+            }
+
+        private:
+
+            srwlock& m_lock;
+        };
+
+        static void append_histogram(std::wstring& result, wchar_t const* label, std::array<uint64_t, lock_histogram_size> const& histogram)
+        {
+            result += label;
+
+            for (uint32_t index = 0; index < lock_histogram_size; ++index)
+            {
+                result += (index ? L"," : L"[") + std::to_wstring(histogram[index]);
+            }
+
+            result += L']';
+        }
+
+        srwlock m_lock{};
+        std::map<std::wstring_view, lock_site> m_sites;
+        lock_site m_unattributed;
+    };
+
+    inline lock_diagnostics_cache& get_lock_diagnostics() noexcept
+    {
+        // Intentionally leaked so that locks in other static objects can still be counted during shutdown.
+        static lock_diagnostics_cache* const info{ new lock_diagnostics_cache() };
+        return *info;
+    }
+}
+
+WINRT_EXPORT namespace winrt
+{
+    using lock_diagnostics_info = impl::lock_diagnostics_info;
+
+    // Returns the statistics gathered so far for each lock site, keyed by the name given to its locks.
+    inline std::map<std::wstring_view, lock_diagnostics_info> get_lock_diagnostics()
+    {
+        return impl::get_lock_diagnostics().get();
+    }
+
+    // Returns the statistics gathered so far and starts counting again from zero.
+    inline std::map<std::wstring_view, lock_diagnostics_info> reset_lock_diagnostics()
+    {
+        return impl::get_lock_diagnostics().detach();
+    }
+
+    // Formats the statistics as one line per lock site, most contended first.
+    inline std::wstring dump_lock_diagnostics()
+    {
+        return impl::get_lock_diagnostics().dump();
+    }
+}
+
+#endif
+
 WINRT_EXPORT namespace winrt
 {
     struct slim_condition_variable;
@@ -9,6 +253,72 @@ WINRT_EXPORT namespace winrt
         slim_mutex& operator=(slim_mutex const&) = delete;
         slim_mutex() noexcept = default;
 
+#ifdef WINRT_LOCK_DIAGNOSTICS
+        void lock() noexcept
+        {
+            if (!WINRT_IMPL_TryAcquireSRWLockExclusive(&m_lock))
+            {
+                uint64_t const start = impl::lock_clock();
+                WINRT_IMPL_AcquireSRWLockExclusive(&m_lock);
+                m_acquired = impl::lock_clock();
+                site().waited(m_acquired - start);
+            }
+            else
+            {
+                m_acquired = impl::lock_clock();
+            }
+
+            site().acquired();
+        }
+
+        void lock_shared() noexcept
+        {
+            if (!WINRT_IMPL_TryAcquireSRWLockShared(&m_lock))
+            {
+                uint64_t const start = impl::lock_clock();
+                WINRT_IMPL_AcquireSRWLockShared(&m_lock);
+                site().waited(impl::lock_clock() - start);
+            }
+
+            site().acquired();
+        }
+
+        bool try_lock() noexcept
+        {
+            if (0 == WINRT_IMPL_TryAcquireSRWLockExclusive(&m_lock))
+            {
+                return false;
+            }
+
+            m_acquired = impl::lock_clock();
+            site().acquired();
+            return true;
+        }
+
+        bool try_lock_shared() noexcept
+        {
+            if (0 == WINRT_IMPL_TryAcquireSRWLockShared(&m_lock))
+            {
+                return false;
+            }
+
+            site().acquired();
+            return true;
+        }
+
+        void unlock() noexcept
+        {
+            // Shared holds overlap, so only exclusive holds are timed.
+            site().held(impl::lock_clock() - m_acquired);
+            WINRT_IMPL_ReleaseSRWLockExclusive(&m_lock);
+        }
+
+        // Attributes this lock's statistics to a named site. The name must have static lifetime.
+        void diagnostics_name(std::wstring_view const name)
+        {
+            m_site = &impl::get_lock_diagnostics().site(name);
+        }
+#else
         void lock() noexcept
         {
             WINRT_IMPL_AcquireSRWLockExclusive(&m_lock);
@@ -33,6 +343,7 @@ WINRT_EXPORT namespace winrt
         {
             WINRT_IMPL_ReleaseSRWLockExclusive(&m_lock);
         }
+#endif
 
         void unlock_shared() noexcept
         {
@@ -48,6 +359,21 @@ WINRT_EXPORT namespace winrt
         }
 
         impl::srwlock m_lock{};
+
+#ifdef WINRT_LOCK_DIAGNOSTICS
+        impl::lock_site& site() const noexcept
+        {
+            return m_site ? *m_site : impl::get_lock_diagnostics().unattributed();
+        }
+
+        void reacquired() noexcept
+        {
+            m_acquired = impl::lock_clock();
+        }
+
+        impl::lock_site* m_site{};
+        uint64_t m_acquired{};
+#endif
     };
 
     struct slim_lock_guard
@@ -99,7 +425,13 @@ WINRT_EXPORT namespace winrt
         {
             while (!predicate())
             {
+#ifdef WINRT_LOCK_DIAGNOSTICS
+                x.site().held(impl::lock_clock() - x.m_acquired);
+                WINRT_VERIFY(WINRT_IMPL_SleepConditionVariableSRW(&m_cv, x.get(), 0xFFFFFFFF /*INFINITE*/, 0));
+                x.reacquired();
+#else
                 WINRT_VERIFY(WINRT_IMPL_SleepConditionVariableSRW(&m_cv, x.get(), 0xFFFFFFFF /*INFINITE*/, 0));
+#endif
             }
         }
 
@@ -117,7 +449,15 @@ WINRT_EXPORT namespace winrt
                     return false;
                 }
 
-                if (!WINRT_IMPL_SleepConditionVariableSRW(&m_cv, x.get(), static_cast<uint32_t>(milliseconds), 0))
+#ifdef WINRT_LOCK_DIAGNOSTICS
+                x.site().held(impl::lock_clock() - x.m_acquired);
+                bool const woken = WINRT_IMPL_SleepConditionVariableSRW(&m_cv, x.get(), static_cast<uint32_t>(milliseconds), 0);
+                x.reacquired();
+#else
+                bool const woken = WINRT_IMPL_SleepConditionVariableSRW(&m_cv, x.get(), static_cast<uint32_t>(milliseconds), 0);
+#endif
+
+                if (!woken)
                 {
                     return predicate();
                 }
@@ -140,3 +480,404 @@ WINRT_EXPORT namespace winrt
         impl::condition_variable m_cv{};
     };
 }
+
+namespace winrt::impl
+{
+    // Guards for the types that take their lock as a policy parameter, which may be any type with the slim_mutex
+    // interface.
+    template <typename Mutex>
+    struct lock_guard
+    {
+        explicit lock_guard(Mutex& m) noexcept :
+            m_mutex(m)
+        {
+            m_mutex.lock();
+        }
+
+        lock_guard(lock_guard const&) = delete;
+
+        ~lock_guard() noexcept
+        {
+            m_mutex.unlock();
+        }
+
+    private:
+        Mutex& m_mutex;
+    };
+
+    template <typename Mutex>
+    struct shared_lock_guard
+    {
+        explicit shared_lock_guard(Mutex& m) noexcept :
+            m_mutex(m)
+        {
+            m_mutex.lock_shared();
+        }
+
+        shared_lock_guard(shared_lock_guard const&) = delete;
+
+        ~shared_lock_guard() noexcept
+        {
+            m_mutex.unlock_shared();
+        }
+
+    private:
+        Mutex& m_mutex;
+    };
+
+#ifdef WINRT_LOCK_DIAGNOSTICS
+    // Attributes a lock owned by some library type to Owner's runtime class name, or to fallback when Owner
+    // isn't a WinRT type. Only slim_mutex is instrumented, so other locks are left alone.
+    template <typename Owner, typename Lock>
+    void name_lock(Lock& lock, std::wstring_view const fallback = {})
+    {
+        if constexpr (std::is_same_v<Lock, slim_mutex>)
+        {
+            if constexpr (has_category_v<Owner>)
+            {
+                lock.diagnostics_name(name_of<Owner>());
+            }
+            else if (!fallback.empty())
+            {
+                lock.diagnostics_name(fallback);
+            }
+        }
+    }
+#endif
+
+    // The MSVC intrinsics are declared by <intrin0.h>, which <atomic> already includes.
+    inline void cpu_pause() noexcept
+    {
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+        _mm_pause();
+#elif defined(_MSC_VER) && (defined(_M_ARM) || defined(_M_ARM64))
+        __yield();
+#elif defined(__i386__) || defined(__x86_64__)
+        __builtin_ia32_pause();
+#elif defined(__arm__) || defined(__aarch64__)
+        __asm__ __volatile__("yield");
+#endif
+    }
+
+    // Parks the calling thread for as long as value still holds compare. Wakeups may be spurious.
+    inline void address_wait(std::atomic<uint32_t>& value, uint32_t compare) noexcept
+    {
+        static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t));
+#if defined(WINRT_PORTABLE) && defined(__linux__)
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&value), FUTEX_WAIT_PRIVATE, compare, nullptr, nullptr, 0);
+#else
+        WINRT_IMPL_WaitOnAddress(&value, &compare, sizeof(compare), 0xFFFFFFFF /*INFINITE*/);
+#endif
+    }
+
+    inline void address_wake_all(std::atomic<uint32_t>& value) noexcept
+    {
+#if defined(WINRT_PORTABLE) && defined(__linux__)
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&value), FUTEX_WAKE_PRIVATE, INT32_MAX, nullptr, nullptr, 0);
+#else
+        WINRT_IMPL_WakeByAddressAll(&value);
+#endif
+    }
+}
+
+WINRT_EXPORT namespace winrt
+{
+    // A reader/writer lock built directly on address waits (WaitOnAddress or a futex) with the same interface as
+    // slim_mutex. On Windows this needs WaitOnAddress from WindowsApp.lib or Synchronization.lib. Readers don't
+    // queue behind waiting writers, so a steady stream of readers can hold off a writer.
+    struct futex_mutex
+    {
+        futex_mutex(futex_mutex const&) = delete;
+        futex_mutex& operator=(futex_mutex const&) = delete;
+        futex_mutex() noexcept = default;
+
+        void lock() noexcept
+        {
+            if (!try_lock())
+            {
+                lock_contended();
+            }
+        }
+
+        void lock_shared() noexcept
+        {
+            if (!try_lock_shared())
+            {
+                lock_shared_contended();
+            }
+        }
+
+        bool try_lock() noexcept
+        {
+            uint32_t expected{};
+            return m_state.compare_exchange_strong(expected, writer, std::memory_order_acquire, std::memory_order_relaxed);
+        }
+
+        bool try_lock_shared() noexcept
+        {
+            uint32_t state = m_state.load(std::memory_order_relaxed);
+
+            while (!(state & writer))
+            {
+                if (m_state.compare_exchange_weak(state, state + reader, std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        void unlock() noexcept
+        {
+            if (m_state.exchange(0, std::memory_order_release) & waiters)
+            {
+                impl::address_wake_all(m_state);
+            }
+        }
+
+        void unlock_shared() noexcept
+        {
+            uint32_t const state = m_state.fetch_sub(reader, std::memory_order_release);
+
+            // Only the last reader out wakes the waiting writers.
+            if ((state & ~waiters) == reader && (state & waiters))
+            {
+                // If another thread got in first it keeps the waiters bit for its own unlock.
+                uint32_t expected{ waiters };
+                m_state.compare_exchange_strong(expected, 0, std::memory_order_relaxed);
+                impl::address_wake_all(m_state);
+            }
+        }
+
+    protected:
+
+        static constexpr uint32_t writer{ 1 };
+        static constexpr uint32_t waiters{ 2 };
+        static constexpr uint32_t reader{ 4 };
+
+        bool is_locked() const noexcept
+        {
+            return (m_state.load(std::memory_order_relaxed) & ~waiters) != 0;
+        }
+
+        bool is_write_locked() const noexcept
+        {
+            return (m_state.load(std::memory_order_relaxed) & writer) != 0;
+        }
+
+    private:
+
+        void lock_contended() noexcept
+        {
+            uint32_t state = m_state.load(std::memory_order_relaxed);
+
+            while (true)
+            {
+                if (!(state & ~waiters))
+                {
+                    // Other threads may still be parked, so keep the waiters bit for unlock to see.
+                    if (m_state.compare_exchange_weak(state, writer | waiters, std::memory_order_acquire, std::memory_order_relaxed))
+                    {
+                        return;
+                    }
+                }
+                else if ((state & waiters) || m_state.compare_exchange_weak(state, state | waiters, std::memory_order_relaxed))
+                {
+                    impl::address_wait(m_state, state | waiters);
+                    state = m_state.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        void lock_shared_contended() noexcept
+        {
+            uint32_t state = m_state.load(std::memory_order_relaxed);
+
+            while (true)
+            {
+                if (!(state & writer))
+                {
+                    if (m_state.compare_exchange_weak(state, state + reader, std::memory_order_acquire, std::memory_order_relaxed))
+                    {
+                        return;
+                    }
+                }
+                else if ((state & waiters) || m_state.compare_exchange_weak(state, state | waiters, std::memory_order_relaxed))
+                {
+                    impl::address_wait(m_state, state | waiters);
+                    state = m_state.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        std::atomic<uint32_t> m_state{};
+    };
+
+    // A futex_mutex that spins before parking. The spin limit follows how long recent acquisitions actually spun,
+    // so short critical sections avoid a context switch without long ones burning the processor.
+    struct adaptive_mutex : futex_mutex
+    {
+        void lock() noexcept
+        {
+            if (!try_lock() && !spin([this] { return !is_locked() && try_lock(); }))
+            {
+                futex_mutex::lock();
+            }
+        }
+
+        void lock_shared() noexcept
+        {
+            if (!try_lock_shared() && !spin([this] { return !is_write_locked() && try_lock_shared(); }))
+            {
+                futex_mutex::lock_shared();
+            }
+        }
+
+    private:
+
+        static constexpr uint32_t max_spin{ 4000 };
+
+        template <typename F>
+        bool spin(F&& acquire) noexcept
+        {
+            int32_t const estimate = static_cast<int32_t>(m_spin.load(std::memory_order_relaxed));
+            int32_t const limit = (std::min)(estimate * 2 + 16, static_cast<int32_t>(max_spin));
+            int32_t count = 0;
+
+            for (; count < limit; ++count)
+            {
+                impl::cpu_pause();
+
+                if (acquire())
+                {
+                    break;
+                }
+            }
+
+            m_spin.store(static_cast<uint32_t>(estimate + (count - estimate) / 8), std::memory_order_relaxed);
+            return count < limit;
+        }
+
+        std::atomic<uint32_t> m_spin{};
+    };
+
+    // A reader-biased lock for read-mostly state. Each reader only touches one of several cache line sized
+    // counters, picked by thread, so readers don't contend with each other. Writers pay for this: they take a
+    // slim_mutex and then wait for every counter to drain.
+    struct distributed_shared_mutex
+    {
+        static constexpr uint32_t slot_count{ 16 };
+
+        distributed_shared_mutex(distributed_shared_mutex const&) = delete;
+        distributed_shared_mutex& operator=(distributed_shared_mutex const&) = delete;
+        distributed_shared_mutex() noexcept = default;
+
+        void lock() noexcept
+        {
+            m_writer.lock();
+            m_pending.store(true, std::memory_order_seq_cst);
+
+            for (auto& slot : m_slots)
+            {
+                uint32_t count;
+
+                while ((count = slot.value.load(std::memory_order_seq_cst)) != 0)
+                {
+                    impl::address_wait(slot.value, count);
+                }
+            }
+        }
+
+        bool try_lock() noexcept
+        {
+            if (!m_writer.try_lock())
+            {
+                return false;
+            }
+
+            m_pending.store(true, std::memory_order_seq_cst);
+
+            for (auto& slot : m_slots)
+            {
+                if (slot.value.load(std::memory_order_seq_cst) != 0)
+                {
+                    unlock();
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        void unlock() noexcept
+        {
+            m_pending.store(false, std::memory_order_release);
+            m_writer.unlock();
+        }
+
+        void lock_shared() noexcept
+        {
+            auto& slot = current_slot();
+
+            while (true)
+            {
+                slot.fetch_add(1, std::memory_order_seq_cst);
+
+                if (!m_pending.load(std::memory_order_seq_cst))
+                {
+                    return;
+                }
+
+                release(slot);
+
+                // Park behind the writer rather than spinning on the flag.
+                m_writer.lock_shared();
+                m_writer.unlock_shared();
+            }
+        }
+
+        bool try_lock_shared() noexcept
+        {
+            auto& slot = current_slot();
+            slot.fetch_add(1, std::memory_order_seq_cst);
+
+            if (!m_pending.load(std::memory_order_seq_cst))
+            {
+                return true;
+            }
+
+            release(slot);
+            return false;
+        }
+
+        void unlock_shared() noexcept
+        {
+            release(current_slot());
+        }
+
+    private:
+
+        struct alignas(64) reader_slot
+        {
+            std::atomic<uint32_t> value{};
+        };
+
+        std::atomic<uint32_t>& current_slot() noexcept
+        {
+            return m_slots[std::hash<std::thread::id>{}(std::this_thread::get_id()) % slot_count].value;
+        }
+
+        void release(std::atomic<uint32_t>& slot) noexcept
+        {
+            if (slot.fetch_sub(1, std::memory_order_seq_cst) == 1 && m_pending.load(std::memory_order_seq_cst))
+            {
+                impl::address_wake_all(slot);
+            }
+        }
+
+        reader_slot m_slots[slot_count];
+        std::atomic<bool> m_pending{};
+        slim_mutex m_writer;
+    };
+}
@@ -1,7 +1,21 @@
 
+#ifndef _WIN32
+// Microsoft-specific keywords used by the runtime support and generated code, for compilers that don't know them.
+#define __stdcall
+#define __declspec(attribute) WINRT_IMPL_DECLSPEC_##attribute
+#define WINRT_IMPL_DECLSPEC_selectany inline
+#define WINRT_IMPL_DECLSPEC_novtable
+#define WINRT_IMPL_DECLSPEC_empty_bases
+#define WINRT_IMPL_DECLSPEC_noinline __attribute__((noinline))
+#endif
+
 #ifdef _DEBUG
 
+#ifdef _WIN32
 #define WINRT_ASSERT _ASSERTE
+#else
+#define WINRT_ASSERT assert
+#endif
 #define WINRT_VERIFY WINRT_ASSERT
 #define WINRT_VERIFY_(result, expression) WINRT_ASSERT(result == expression)
 
@@ -21,11 +35,13 @@
 #define WINRT_IMPL_AUTO(...) auto
 #endif
 
+#ifdef _MSC_VER
 // Note: this is a workaround for a false-positive warning produced by the Visual C++ 15.9 compiler.
 #pragma warning(disable : 5046)
 
 // Note: this is a workaround for a false-positive warning produced by the Visual C++ 16.3 compiler.
 #pragma warning(disable : 4268)
+#endif
 
 #if defined(__cpp_lib_coroutine) || defined(__cpp_coroutines) || defined(_RESUMABLE_FUNCTIONS_SUPPORTED)
 #define WINRT_IMPL_COROUTINES
@@ -3,6 +3,12 @@ namespace winrt::impl
 {
     inline int32_t make_marshaler(unknown_abi* outer, void** result) noexcept
     {
+#ifdef WINRT_PORTABLE
+        // Nothing is ever marshaled without COM, so don't pretend to be free-threaded.
+        (void)outer;
+        *result = nullptr;
+        return error_no_interface;
+#else
         struct marshaler final : IMarshal
         {
             marshaler(unknown_abi* object) noexcept
@@ -116,5 +122,6 @@ namespace winrt::impl
 
         *result = new (std::nothrow) marshaler(outer);
         return *result ? error_ok : error_bad_alloc;
+#endif
     }
 }
@@ -0,0 +1,13 @@
+
+WINRT_EXPORT namespace winrt
+{
+    inline array_view<uint8_t> data_span(Windows::Foundation::IMemoryBufferReference const& reference)
+    {
+        uint8_t* data{};
+        uint32_t capacity{};
+        check_hresult(reference.as<impl::IMemoryBufferByteAccess>()->GetBuffer(&data, &capacity));
+
+        // The bytes are only valid until the reference is closed.
+        return { data, capacity };
+    }
+}
@@ -54,6 +54,30 @@ namespace winrt::impl
         using type = T;
     };
 
+#ifdef __cpp_pack_indexing
+    template <size_t Index, typename... T>
+    using pack_element = T...[Index];
+#else
+    template <size_t Index, typename T>
+    struct pack_element_base
+    {
+        using type = T;
+    };
+
+    template <typename Indexes, typename... T>
+    struct pack_elements;
+
+    template <size_t... Index, typename... T>
+    struct pack_elements<std::index_sequence<Index...>, T...> : pack_element_base<Index, T>... {};
+
+    template <size_t Index, typename T>
+    pack_element_base<Index, T> select_pack_element(pack_element_base<Index, T> const&);
+
+    // Selects the element by overload resolution against a flat set of bases rather than by peeling off the pack.
+    template <size_t Index, typename... T>
+    using pack_element = typename decltype(select_pack_element<Index>(std::declval<pack_elements<std::index_sequence_for<T...>, T...>>()))::type;
+#endif
+
     template <typename T, typename Enable = void>
     struct abi
     {
@@ -92,6 +92,7 @@ extern "C"
 __declspec(selectany)
 decltype(winrt::impl::natvis::get_val) & WINRT_get_val = winrt::impl::natvis::get_val;
 
+#if defined(_MSC_VER)
 #ifdef _M_IX86
 #pragma comment(linker, "/include:_WINRT_abi_val")
 #pragma comment(linker, "/include:_WINRT_get_val")
@@ -99,5 +100,6 @@ decltype(winrt::impl::natvis::get_val) & WINRT_get_val = winrt::impl::natvis::ge
 #pragma comment(linker, "/include:WINRT_abi_val")
 #pragma comment(linker, "/include:WINRT_get_val")
 #endif
+#endif
 
 #endif
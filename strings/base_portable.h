@@ -0,0 +1,1564 @@
+
+#ifdef WINRT_PORTABLE
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+#ifndef __cpp_lib_atomic_ref
+#error The portable backend requires C++20 and std::atomic_ref
+#endif
+
+// The portable backend implements the WINRT_IMPL_* surface with the standard library so that the runtime support in
+// this header can be built, tested, and benchmarked without Win32 or COM. Every thread belongs to a single implicit
+// MTA, nothing is marshaled, and activation only finds factories added with winrt::register_activation_factory.
+
+namespace winrt::impl
+{
+    inline thread_local uint32_t portable_last_error{};
+
+    inline int32_t portable_fail(uint32_t const error) noexcept
+    {
+        portable_last_error = error;
+        return 0;
+    }
+
+    using portable_clock = std::chrono::steady_clock;
+
+    inline int64_t portable_filetime() noexcept
+    {
+        // The number of 100ns intervals between the FILETIME (1601) and system_clock (1970) epochs.
+        constexpr int64_t epoch_offset{ 116444736000000000 };
+        return epoch_offset + std::chrono::duration_cast<std::chrono::duration<int64_t, filetime_period>>(std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+    inline portable_clock::time_point portable_deadline(uint32_t const milliseconds) noexcept
+    {
+        if (milliseconds == 0xFFFFFFFF) // INFINITE
+        {
+            return portable_clock::time_point::max();
+        }
+
+        return portable_clock::now() + std::chrono::milliseconds(milliseconds);
+    }
+
+    // Due times follow the threadpool convention: negative values are relative and positive values are absolute.
+    inline portable_clock::time_point portable_deadline(int64_t const due) noexcept
+    {
+        int64_t const relative = due < 0 ? -due : (std::max)(due - portable_filetime(), int64_t{});
+        return portable_clock::now() + std::chrono::duration_cast<portable_clock::duration>(std::chrono::duration<int64_t, filetime_period>(relative));
+    }
+
+    struct portable_parking_bucket
+    {
+        std::mutex lock;
+        std::condition_variable changed;
+    };
+
+    inline portable_parking_bucket& portable_parking_lot(void const volatile* address) noexcept
+    {
+        // Intentionally leaked so that detached pool threads can never outlive it.
+        static portable_parking_bucket* const buckets{ new portable_parking_bucket[64] };
+        return buckets[(reinterpret_cast<uintptr_t>(address) >> 4) % 64];
+    }
+
+    template <typename T>
+    bool portable_equal(void const volatile* address, void const* compare) noexcept
+    {
+        T expected;
+        memcpy(&expected, compare, sizeof(T));
+        return std::atomic_ref<T>(*const_cast<T*>(static_cast<T const volatile*>(address))).load(std::memory_order_acquire) == expected;
+    }
+
+    inline bool portable_equal(void const volatile* address, void const* compare, std::size_t const size) noexcept
+    {
+        switch (size)
+        {
+        case 1: return portable_equal<uint8_t>(address, compare);
+        case 2: return portable_equal<uint16_t>(address, compare);
+        case 4: return portable_equal<uint32_t>(address, compare);
+        default: return portable_equal<uint64_t>(address, compare);
+        }
+    }
+
+    // Parks the calling thread for as long as the value at address matches compare. Wakeups may be spurious.
+    // Returns false if the deadline passed first.
+    inline bool portable_park(void const volatile* address, void const* compare, std::size_t const size, portable_clock::time_point const deadline) noexcept
+    {
+        auto& bucket = portable_parking_lot(address);
+        std::unique_lock guard(bucket.lock);
+
+        while (portable_equal(address, compare, size))
+        {
+            if (deadline == portable_clock::time_point::max())
+            {
+                bucket.changed.wait(guard);
+            }
+            else if (bucket.changed.wait_until(guard, deadline) == std::cv_status::timeout)
+            {
+                return !portable_equal(address, compare, size);
+            }
+        }
+
+        return true;
+    }
+
+    // The value at address must already have changed. Taking the bucket lock orders this wake after any
+    // waiter that compared the old value.
+    inline void portable_unpark_all(void const volatile* address) noexcept
+    {
+        auto& bucket = portable_parking_lot(address);
+        {
+            std::lock_guard const guard(bucket.lock);
+        }
+        bucket.changed.notify_all();
+    }
+
+    // An srwlock holds the writer in bit 0, flags parked threads in bit 1, and counts readers in the remaining bits.
+    inline constexpr uintptr_t portable_writer{ 1 };
+    inline constexpr uintptr_t portable_parked{ 2 };
+    inline constexpr uintptr_t portable_reader{ 4 };
+
+    inline std::atomic_ref<uintptr_t> portable_word(void* value) noexcept
+    {
+        static_assert(sizeof(srwlock) == sizeof(uintptr_t));
+        static_assert(sizeof(condition_variable) == sizeof(uintptr_t));
+        return std::atomic_ref<uintptr_t>(*static_cast<uintptr_t*>(value));
+    }
+
+    inline bool portable_available(uintptr_t const state, bool const shared) noexcept
+    {
+        return shared ? !(state & portable_writer) : !(state & ~portable_parked);
+    }
+
+    inline bool portable_try_lock(srwlock* lock, bool const shared) noexcept
+    {
+        auto state = portable_word(lock);
+        uintptr_t current = state.load(std::memory_order_relaxed);
+
+        while (portable_available(current, shared))
+        {
+            uintptr_t const desired = shared ? current + portable_reader : current | portable_writer;
+
+            if (state.compare_exchange_weak(current, desired, std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    inline void portable_lock(srwlock* lock, bool const shared) noexcept
+    {
+        auto state = portable_word(lock);
+
+        while (!portable_try_lock(lock, shared))
+        {
+            uintptr_t current = state.load(std::memory_order_relaxed);
+
+            if (portable_available(current, shared))
+            {
+                continue;
+            }
+
+            // Flag the lock so that the owner knows to wake parked threads on release.
+            if (!(current & portable_parked))
+            {
+                if (!state.compare_exchange_weak(current, current | portable_parked, std::memory_order_relaxed))
+                {
+                    continue;
+                }
+
+                current |= portable_parked;
+            }
+
+            portable_park(lock, &current, sizeof(current), portable_clock::time_point::max());
+        }
+    }
+
+    inline void portable_unlock(srwlock* lock, bool const shared) noexcept
+    {
+        auto state = portable_word(lock);
+
+        if (shared)
+        {
+            // Only the last reader out wakes parked threads, and only if nobody else took the lock in the meantime.
+            if (state.fetch_sub(portable_reader, std::memory_order_release) != (portable_reader | portable_parked))
+            {
+                return;
+            }
+
+            uintptr_t expected{ portable_parked };
+
+            if (!state.compare_exchange_strong(expected, 0, std::memory_order_relaxed))
+            {
+                return;
+            }
+        }
+        else if (!(state.exchange(0, std::memory_order_release) & portable_parked))
+        {
+            return;
+        }
+
+        portable_unpark_all(lock);
+    }
+
+    inline int32_t portable_sleep(condition_variable* cv, srwlock* lock, uint32_t const milliseconds, uint32_t const flags) noexcept
+    {
+        bool const shared = flags & 0x1; // CONDITION_VARIABLE_LOCKMODE_SHARED
+        uintptr_t const sequence = portable_word(cv).load(std::memory_order_relaxed);
+        portable_unlock(lock, shared);
+        bool const woken = portable_park(cv, &sequence, sizeof(sequence), portable_deadline(milliseconds));
+        portable_lock(lock, shared);
+        return woken ? 1 : portable_fail(1460 /*ERROR_TIMEOUT*/);
+    }
+
+    inline void portable_notify(condition_variable* cv) noexcept
+    {
+        portable_word(cv).fetch_add(1, std::memory_order_relaxed);
+        portable_unpark_all(cv);
+    }
+
+    struct portable_pool
+    {
+        using callback_type = void(__stdcall*)(void*, void* context);
+
+        bool submit(callback_type callback, void* context) noexcept
+        {
+            std::lock_guard const guard(m_lock);
+
+            if (m_closed)
+            {
+                return portable_fail(6 /*ERROR_INVALID_HANDLE*/);
+            }
+
+            try
+            {
+                m_queue.emplace_back(callback, context);
+            }
+            catch (...)
+            {
+                return portable_fail(8 /*ERROR_NOT_ENOUGH_MEMORY*/);
+            }
+
+            if (m_queue.size() > m_idle && !start())
+            {
+                if (m_threads == 0)
+                {
+                    m_queue.pop_back();
+                    return portable_fail(8 /*ERROR_NOT_ENOUGH_MEMORY*/);
+                }
+            }
+
+            m_ready.notify_one();
+            return true;
+        }
+
+        void maximum(uint32_t const value) noexcept
+        {
+            std::lock_guard const guard(m_lock);
+            m_maximum = (std::max)(value, uint32_t{ 1 });
+            m_minimum = (std::min)(m_minimum, m_maximum);
+        }
+
+        bool minimum(uint32_t const value) noexcept
+        {
+            std::lock_guard const guard(m_lock);
+            m_minimum = value;
+            m_maximum = (std::max)(m_maximum, m_minimum);
+
+            while (m_threads < m_minimum)
+            {
+                if (!start())
+                {
+                    return portable_fail(8 /*ERROR_NOT_ENOUGH_MEMORY*/);
+                }
+            }
+
+            return true;
+        }
+
+        // Queued callbacks still run, after which the last thread out deletes the pool.
+        void close() noexcept
+        {
+            {
+                std::lock_guard const guard(m_lock);
+                m_closed = true;
+
+                if (m_threads != 0)
+                {
+                    m_ready.notify_all();
+                    return;
+                }
+            }
+
+            delete this;
+        }
+
+    private:
+
+        bool start() noexcept
+        {
+            if (m_threads >= m_maximum)
+            {
+                return false;
+            }
+
+            try
+            {
+                std::thread([this] { run(); }).detach();
+            }
+            catch (...)
+            {
+                return false;
+            }
+
+            ++m_threads;
+            return true;
+        }
+
+        void run() noexcept
+        {
+            std::unique_lock guard(m_lock);
+
+            while (true)
+            {
+                if (m_queue.empty())
+                {
+                    if (m_closed)
+                    {
+                        break;
+                    }
+
+                    ++m_idle;
+                    bool const timed_out = m_ready.wait_for(guard, std::chrono::seconds(20)) == std::cv_status::timeout;
+                    --m_idle;
+
+                    if (timed_out && m_queue.empty() && m_threads > m_minimum)
+                    {
+                        break;
+                    }
+
+                    continue;
+                }
+
+                auto const [callback, context] = m_queue.front();
+                m_queue.pop_front();
+                guard.unlock();
+                callback(nullptr, context);
+                guard.lock();
+            }
+
+            bool const last = --m_threads == 0 && m_closed;
+            guard.unlock();
+
+            if (last)
+            {
+                delete this;
+            }
+        }
+
+        std::mutex m_lock;
+        std::condition_variable m_ready;
+        std::deque<std::pair<callback_type, void*>> m_queue;
+        std::size_t m_idle{};
+        uint32_t m_threads{};
+        uint32_t m_minimum{};
+        uint32_t m_maximum{ 512 };
+        bool m_closed{};
+    };
+
+    inline portable_pool& get_portable_pool() noexcept
+    {
+        // Intentionally leaked so that its threads are never joined during shutdown.
+        static portable_pool* const pool{ new portable_pool() };
+        return *pool;
+    }
+
+    // Timers and waits are reference counted since a callback may still be queued when the object is closed.
+    struct portable_work_item
+    {
+        virtual ~portable_work_item() = default;
+        virtual void expire(uint64_t generation) noexcept = 0;
+
+        void add_ref() noexcept
+        {
+            m_references.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void release() noexcept
+        {
+            if (1 == m_references.fetch_sub(1, std::memory_order_acq_rel))
+            {
+                delete this;
+            }
+        }
+
+    private:
+
+        std::atomic<uint32_t> m_references{ 1 };
+    };
+
+    struct portable_timer_queue
+    {
+        // An expiry whose generation is stale by the time it comes due is simply ignored by the item.
+        bool schedule(portable_clock::time_point const due, portable_work_item* item, uint64_t const generation) noexcept
+        {
+            if (due == portable_clock::time_point::max())
+            {
+                return true;
+            }
+
+            std::lock_guard const guard(m_lock);
+
+            if (!m_started)
+            {
+                try
+                {
+                    std::thread([this] { run(); }).detach();
+                }
+                catch (...)
+                {
+                    return portable_fail(8 /*ERROR_NOT_ENOUGH_MEMORY*/);
+                }
+
+                m_started = true;
+            }
+
+            bool const earliest = m_due.empty() || due < m_due.begin()->first;
+
+            try
+            {
+                m_due.emplace(due, std::pair{ item, generation });
+            }
+            catch (...)
+            {
+                return portable_fail(8 /*ERROR_NOT_ENOUGH_MEMORY*/);
+            }
+
+            item->add_ref();
+
+            if (earliest)
+            {
+                m_changed.notify_one();
+            }
+
+            return true;
+        }
+
+    private:
+
+        void run() noexcept
+        {
+            std::unique_lock guard(m_lock);
+
+            while (true)
+            {
+                if (m_due.empty())
+                {
+                    m_changed.wait(guard);
+                    continue;
+                }
+
+                auto const due = m_due.begin()->first;
+
+                if (portable_clock::now() < due)
+                {
+                    m_changed.wait_until(guard, due);
+                    continue;
+                }
+
+                auto const [item, generation] = m_due.begin()->second;
+                m_due.erase(m_due.begin());
+                guard.unlock();
+                item->expire(generation);
+                item->release();
+                guard.lock();
+            }
+        }
+
+        std::mutex m_lock;
+        std::condition_variable m_changed;
+        std::multimap<portable_clock::time_point, std::pair<portable_work_item*, uint64_t>> m_due;
+        bool m_started{};
+    };
+
+    inline portable_timer_queue& get_portable_timer_queue() noexcept
+    {
+        static portable_timer_queue* const queue{ new portable_timer_queue() };
+        return *queue;
+    }
+
+    struct portable_threadpool_timer final : portable_work_item
+    {
+        using callback_type = void(__stdcall*)(void*, void* context, void*);
+
+        portable_threadpool_timer(callback_type callback, void* context) noexcept :
+            m_callback(callback),
+            m_context(context)
+        {
+        }
+
+        // Returns whether a pending expiry was canceled, as SetThreadpoolTimerEx does.
+        bool set(int64_t const* due, uint32_t const period) noexcept
+        {
+            uint64_t generation;
+            bool pending;
+
+            {
+                std::lock_guard const guard(m_lock);
+                generation = ++m_generation;
+                pending = std::exchange(m_pending, due != nullptr);
+                m_period = period;
+            }
+
+            if (due)
+            {
+                get_portable_timer_queue().schedule(portable_deadline(*due), this, generation);
+            }
+
+            return pending;
+        }
+
+        void close() noexcept
+        {
+            set(nullptr, 0);
+            release();
+        }
+
+        void expire(uint64_t const generation) noexcept final
+        {
+            {
+                std::lock_guard const guard(m_lock);
+
+                if (generation != m_generation || !m_pending)
+                {
+                    return;
+                }
+
+                if (m_period == 0)
+                {
+                    m_pending = false;
+                }
+                else
+                {
+                    get_portable_timer_queue().schedule(portable_clock::now() + std::chrono::milliseconds(m_period), this, generation);
+                }
+            }
+
+            add_ref();
+
+            if (!get_portable_pool().submit(callback, this))
+            {
+                release();
+            }
+        }
+
+    private:
+
+        static void __stdcall callback(void*, void* context) noexcept
+        {
+            auto that = static_cast<portable_threadpool_timer*>(context);
+            that->m_callback(nullptr, that->m_context, that);
+            that->release();
+        }
+
+        callback_type const m_callback;
+        void* const m_context;
+        std::mutex m_lock;
+        uint64_t m_generation{};
+        uint32_t m_period{};
+        bool m_pending{};
+    };
+
+    struct portable_threadpool_wait;
+
+    // All event state is guarded by a single lock, which also lets WaitForMultipleObjects observe several events at once.
+    struct portable_events
+    {
+        std::mutex lock;
+        std::condition_variable changed;
+    };
+
+    inline portable_events& get_portable_events() noexcept
+    {
+        static portable_events* const events{ new portable_events() };
+        return *events;
+    }
+
+    struct portable_event
+    {
+        bool const manual_reset;
+        bool signaled;
+        std::vector<portable_threadpool_wait*> waits;
+
+        // Handles that are not events, such as the pseudo handle for the current process, are never signaled.
+        static portable_event* from(void* handle) noexcept
+        {
+            if (handle == nullptr || handle == reinterpret_cast<void*>(-1) || handle == reinterpret_cast<void*>(-2))
+            {
+                return nullptr;
+            }
+
+            return static_cast<portable_event*>(handle);
+        }
+
+        bool try_acquire() noexcept
+        {
+            if (!signaled)
+            {
+                return false;
+            }
+
+            if (!manual_reset)
+            {
+                signaled = false;
+            }
+
+            return true;
+        }
+    };
+
+    struct portable_threadpool_wait final : portable_work_item
+    {
+        using callback_type = void(__stdcall*)(void*, void* context, void*, uint32_t result);
+
+        portable_threadpool_wait(callback_type callback, void* context) noexcept :
+            m_callback(callback),
+            m_context(context)
+        {
+        }
+
+        // Returns whether a pending wait was canceled, as SetThreadpoolWaitEx does.
+        bool set(void* handle, int64_t const* timeout) noexcept
+        {
+            uint64_t generation;
+            bool pending;
+
+            {
+                auto& events = get_portable_events();
+                std::lock_guard const guard(events.lock);
+                pending = std::exchange(m_pending, false);
+                detach();
+                generation = ++m_generation;
+
+                if (handle == nullptr)
+                {
+                    return pending;
+                }
+
+                m_pending = true;
+
+                if (auto event = portable_event::from(handle))
+                {
+                    if (event->try_acquire())
+                    {
+                        fire(0 /*WAIT_OBJECT_0*/);
+                        return pending;
+                    }
+
+                    try
+                    {
+                        event->waits.push_back(this);
+                        m_event = event;
+                    }
+                    catch (...)
+                    {
+                        fire(0xFFFFFFFF /*WAIT_FAILED*/);
+                        return pending;
+                    }
+                }
+
+                if (!timeout)
+                {
+                    return pending;
+                }
+            }
+
+            get_portable_timer_queue().schedule(portable_deadline(*timeout), this, generation);
+            return pending;
+        }
+
+        void close() noexcept
+        {
+            set(nullptr, nullptr);
+            release();
+        }
+
+        void expire(uint64_t const generation) noexcept final
+        {
+            auto& events = get_portable_events();
+            std::lock_guard const guard(events.lock);
+
+            if (generation == m_generation && m_pending)
+            {
+                fire(258 /*WAIT_TIMEOUT*/);
+            }
+        }
+
+        // Called with the events lock held.
+        void fire(uint32_t const result) noexcept
+        {
+            detach();
+            m_pending = false;
+            ++m_generation;
+            m_result = result;
+            add_ref();
+
+            if (!get_portable_pool().submit(callback, this))
+            {
+                release();
+            }
+        }
+
+        // Called with the events lock held, either by this wait or by an event being closed.
+        void detach() noexcept
+        {
+            if (m_event)
+            {
+                auto& waits = m_event->waits;
+                waits.erase(std::remove(waits.begin(), waits.end(), this), waits.end());
+                m_event = nullptr;
+            }
+        }
+
+    private:
+
+        static void __stdcall callback(void*, void* context) noexcept
+        {
+            auto that = static_cast<portable_threadpool_wait*>(context);
+            that->m_callback(nullptr, that->m_context, that, that->m_result);
+            that->release();
+        }
+
+        callback_type const m_callback;
+        void* const m_context;
+        portable_event* m_event{};
+        uint64_t m_generation{};
+        uint32_t m_result{};
+        bool m_pending{};
+    };
+
+    inline int32_t portable_set_event(void* handle) noexcept
+    {
+        auto event = portable_event::from(handle);
+
+        if (!event)
+        {
+            return portable_fail(6 /*ERROR_INVALID_HANDLE*/);
+        }
+
+        auto& events = get_portable_events();
+
+        {
+            std::lock_guard const guard(events.lock);
+            event->signaled = true;
+
+            while (!event->waits.empty() && event->try_acquire())
+            {
+                event->waits.front()->fire(0 /*WAIT_OBJECT_0*/);
+            }
+        }
+
+        events.changed.notify_all();
+        return 1;
+    }
+
+    inline uint32_t portable_wait_for(uint32_t const count, void* const* handles, bool const wait_all, uint32_t const milliseconds) noexcept
+    {
+        // Like WaitForMultipleObjects, a handle may only appear once.
+        bool const duplicates = std::any_of(handles, handles + count, [&](void* const& handle)
+        {
+            return std::find(&handle + 1, handles + count, handle) != handles + count;
+        });
+
+        if (count == 0 || count > 64 /*MAXIMUM_WAIT_OBJECTS*/ || duplicates)
+        {
+            portable_fail(87 /*ERROR_INVALID_PARAMETER*/);
+            return 0xFFFFFFFF; // WAIT_FAILED
+        }
+
+        auto const deadline = portable_deadline(milliseconds);
+        auto& events = get_portable_events();
+        std::unique_lock guard(events.lock);
+
+        while (true)
+        {
+            if (wait_all)
+            {
+                bool const all = std::all_of(handles, handles + count, [](void* handle)
+                {
+                    auto event = portable_event::from(handle);
+                    return event && event->signaled;
+                });
+
+                if (all)
+                {
+                    std::for_each(handles, handles + count, [](void* handle)
+                    {
+                        portable_event::from(handle)->try_acquire();
+                    });
+
+                    return 0; // WAIT_OBJECT_0
+                }
+            }
+            else
+            {
+                for (uint32_t index = 0; index < count; ++index)
+                {
+                    auto event = portable_event::from(handles[index]);
+
+                    if (event && event->try_acquire())
+                    {
+                        return index; // WAIT_OBJECT_0 + index
+                    }
+                }
+            }
+
+            if (deadline == portable_clock::time_point::max())
+            {
+                events.changed.wait(guard);
+            }
+            else if (events.changed.wait_until(guard, deadline) == std::cv_status::timeout && portable_clock::now() >= deadline)
+            {
+                return 258; // WAIT_TIMEOUT
+            }
+        }
+    }
+
+    inline int32_t portable_close_handle(void* handle) noexcept
+    {
+        auto event = portable_event::from(handle);
+
+        if (event)
+        {
+            std::lock_guard const guard(get_portable_events().lock);
+
+            // A wait on a closed event can now only time out.
+            while (!event->waits.empty())
+            {
+                event->waits.back()->detach();
+            }
+        }
+
+        delete event;
+        return 1;
+    }
+
+    struct portable_error_info
+    {
+        unknown_abi* value{};
+
+        ~portable_error_info() noexcept
+        {
+            if (value)
+            {
+                value->Release();
+            }
+        }
+    };
+
+    inline thread_local portable_error_info portable_error;
+
+    inline char32_t portable_decode(char const*& first, char const* last) noexcept
+    {
+        // Malformed input is replaced with U+FFFD, as MultiByteToWideChar does without MB_ERR_INVALID_CHARS.
+        static constexpr char32_t minimum[]{ 0, 0x80, 0x800, 0x10000 };
+        auto const lead = static_cast<uint8_t>(*first++);
+
+        if (lead < 0x80)
+        {
+            return lead;
+        }
+
+        uint32_t const count = lead >= 0xF0 ? 3 : lead >= 0xE0 ? 2 : lead >= 0xC0 ? 1 : 0;
+
+        if (count == 0 || lead > 0xF4)
+        {
+            return 0xFFFD;
+        }
+
+        char32_t value = lead & (0x3F >> count);
+
+        for (uint32_t index = 0; index < count; ++index)
+        {
+            if (first == last || (static_cast<uint8_t>(*first) & 0xC0) != 0x80)
+            {
+                return 0xFFFD;
+            }
+
+            value = (value << 6) | (static_cast<uint8_t>(*first++) & 0x3F);
+        }
+
+        if (value < minimum[count] || value > 0x10FFFF || (value >= 0xD800 && value <= 0xDFFF))
+        {
+            return 0xFFFD;
+        }
+
+        return value;
+    }
+
+    inline char32_t portable_decode(wchar_t const*& first, wchar_t const* last) noexcept
+    {
+        char32_t const value = static_cast<char32_t>(*first++);
+
+        if constexpr (sizeof(wchar_t) == 2)
+        {
+            if (value >= 0xD800 && value <= 0xDBFF && first != last && *first >= 0xDC00 && *first <= 0xDFFF)
+            {
+                return 0x10000 + ((value - 0xD800) << 10) + (static_cast<char32_t>(*first++) - 0xDC00);
+            }
+        }
+
+        if (value > 0x10FFFF || (value >= 0xD800 && value <= 0xDFFF))
+        {
+            return 0xFFFD;
+        }
+
+        return value;
+    }
+
+    inline uint32_t portable_encode(char32_t const value, char* out) noexcept
+    {
+        if (value < 0x80)
+        {
+            out[0] = static_cast<char>(value);
+            return 1;
+        }
+
+        uint32_t const count = value < 0x800 ? 2 : value < 0x10000 ? 3 : 4;
+        static constexpr uint8_t lead[]{ 0, 0, 0xC0, 0xE0, 0xF0 };
+
+        for (uint32_t index = count - 1; index > 0; --index)
+        {
+            out[index] = static_cast<char>(0x80 | ((value >> (6 * (count - 1 - index))) & 0x3F));
+        }
+
+        out[0] = static_cast<char>(lead[count] | (value >> (6 * (count - 1))));
+        return count;
+    }
+
+    inline uint32_t portable_encode(char32_t const value, wchar_t* out) noexcept
+    {
+        if constexpr (sizeof(wchar_t) == 2)
+        {
+            if (value >= 0x10000)
+            {
+                out[0] = static_cast<wchar_t>(0xD800 + ((value - 0x10000) >> 10));
+                out[1] = static_cast<wchar_t>(0xDC00 + ((value - 0x10000) & 0x3FF));
+                return 2;
+            }
+        }
+
+        out[0] = static_cast<wchar_t>(value);
+        return 1;
+    }
+
+    // Converts between UTF-8 and wchar_t following MultiByteToWideChar: a negative in_size includes the null
+    // terminator and a zero out_size returns the required length.
+    template <typename From, typename To>
+    int32_t portable_convert(uint32_t const codepage, From const* in, int32_t const in_size, To* out, int32_t const out_size) noexcept
+    {
+        if (codepage != 65001 /*CP_UTF8*/ || in == nullptr || in_size == 0 || out_size < 0)
+        {
+            return portable_fail(87 /*ERROR_INVALID_PARAMETER*/);
+        }
+
+        From const* first = in;
+        From const* const last = in + (in_size < 0 ? std::char_traits<From>::length(in) + 1 : static_cast<std::size_t>(in_size));
+        int32_t written{};
+
+        while (first != last)
+        {
+            To buffer[4];
+            uint32_t const count = portable_encode(portable_decode(first, last), buffer);
+
+            if (out_size != 0)
+            {
+                if (written + static_cast<int32_t>(count) > out_size)
+                {
+                    return portable_fail(122 /*ERROR_INSUFFICIENT_BUFFER*/);
+                }
+
+                std::copy_n(buffer, count, out + written);
+            }
+
+            written += count;
+        }
+
+        return written;
+    }
+
+    inline std::wstring_view portable_message(uint32_t const code) noexcept
+    {
+        switch (code)
+        {
+        case 0x80004001: return L"Not implemented";
+        case 0x80004002: return L"No such interface supported";
+        case 0x80004005: return L"Unspecified error";
+        case 0x80070005: return L"Access is denied.";
+        case 0x8007000E: return L"Not enough memory resources are available to complete this operation.";
+        case 0x80070057: return L"The parameter is incorrect.";
+        case 0x800704C7: return L"The operation was canceled by the user.";
+        case 0x8000000B: return L"The operation attempted to access data outside the valid range";
+        case 0x8000000E: return L"A method was called at an unexpected time.";
+        case 0x80040111: return L"ClassFactory cannot supply requested class";
+        case 0x80040154: return L"Class not registered";
+        default: return {};
+        }
+    }
+
+    inline bool portable_parse(wchar_t const*& string, uint32_t const digits, uint64_t& value) noexcept
+    {
+        value = 0;
+
+        for (uint32_t index = 0; index < digits; ++index)
+        {
+            wchar_t const c = *string++;
+            uint32_t digit;
+
+            if (c >= L'0' && c <= L'9') digit = c - L'0';
+            else if (c >= L'a' && c <= L'f') digit = c - L'a' + 10;
+            else if (c >= L'A' && c <= L'F') digit = c - L'A' + 10;
+            else return false;
+
+            value = (value << 4) | digit;
+        }
+
+        return true;
+    }
+
+    inline int32_t portable_parse_guid(wchar_t const* string, guid& result) noexcept
+    {
+        // {xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx}
+        uint64_t data1, data2, data3, data4, data5;
+
+        if (!string ||
+            *string++ != L'{' || !portable_parse(string, 8, data1) ||
+            *string++ != L'-' || !portable_parse(string, 4, data2) ||
+            *string++ != L'-' || !portable_parse(string, 4, data3) ||
+            *string++ != L'-' || !portable_parse(string, 4, data4) ||
+            *string++ != L'-' || !portable_parse(string, 12, data5) ||
+            *string++ != L'}' || *string != 0)
+        {
+            return error_invalid_argument;
+        }
+
+        result.Data1 = static_cast<uint32_t>(data1);
+        result.Data2 = static_cast<uint16_t>(data2);
+        result.Data3 = static_cast<uint16_t>(data3);
+        result.Data4[0] = static_cast<uint8_t>(data4 >> 8);
+        result.Data4[1] = static_cast<uint8_t>(data4);
+
+        for (uint32_t index = 0; index < 6; ++index)
+        {
+            result.Data4[2 + index] = static_cast<uint8_t>(data5 >> (8 * (5 - index)));
+        }
+
+        return 0;
+    }
+
+    struct portable_bstr
+    {
+        uint32_t bytes;
+        wchar_t value[1];
+    };
+
+    inline int32_t __stdcall portable_SetThreadpoolTimerEx(ptp_timer timer, void* due, uint32_t period, uint32_t) noexcept
+    {
+        return reinterpret_cast<portable_threadpool_timer*>(timer)->set(static_cast<int64_t const*>(due), period);
+    }
+
+    inline int32_t __stdcall portable_SetThreadpoolWaitEx(ptp_wait wait, void* handle, void* timeout, void*) noexcept
+    {
+        return reinterpret_cast<portable_threadpool_wait*>(wait)->set(handle, static_cast<int64_t const*>(timeout));
+    }
+
+    // Stands in for kernel32.dll so that load_runtime_function finds the cancelable threadpool functions.
+    inline int portable_kernel32{};
+}
+
+extern "C"
+{
+    inline void* __stdcall WINRT_IMPL_LoadLibraryW(wchar_t const* name) noexcept
+    {
+        if (name && std::wstring_view(name) == L"kernel32.dll")
+        {
+            return &winrt::impl::portable_kernel32;
+        }
+
+        winrt::impl::portable_fail(126 /*ERROR_MOD_NOT_FOUND*/);
+        return nullptr;
+    }
+
+    inline int32_t __stdcall WINRT_IMPL_FreeLibrary(void*) noexcept
+    {
+        return 1;
+    }
+
+    inline void* __stdcall WINRT_IMPL_GetProcAddress(void* library, char const* name) noexcept
+    {
+        if (library == &winrt::impl::portable_kernel32)
+        {
+            std::string_view const function(name);
+
+            if (function == "SetThreadpoolTimerEx")
+            {
+                return reinterpret_cast<void*>(&winrt::impl::portable_SetThreadpoolTimerEx);
+            }
+
+            if (function == "SetThreadpoolWaitEx")
+            {
+                return reinterpret_cast<void*>(&winrt::impl::portable_SetThreadpoolWaitEx);
+            }
+        }
+
+        winrt::impl::portable_fail(127 /*ERROR_PROC_NOT_FOUND*/);
+        return nullptr;
+    }
+
+    inline int32_t __stdcall WINRT_IMPL_SetErrorInfo(uint32_t, void* info) noexcept
+    {
+        auto value = static_cast<winrt::impl::unknown_abi*>(info);
+
+        if (value)
+        {
+            value->AddRef();
+        }
+
+        if (auto previous = std::exchange(winrt::impl::portable_error.value, value))
+        {
+            previous->Release();
+        }
+
+        return 0;
+    }
+
+    inline int32_t __stdcall WINRT_IMPL_GetErrorInfo(uint32_t, void** info) noexcept
+    {
+        *info = std::exchange(winrt::impl::portable_error.value, nullptr);
+        return *info ? 0 : 1; // S_FALSE
+    }
+
+    inline int32_t __stdcall WINRT_IMPL_CoInitializeEx(void*, uint32_t) noexcept
+    {
+        return 0;
+    }
+
+    inline void __stdcall WINRT_IMPL_CoUninitialize() noexcept
+    {
+    }
+
+    inline int32_t __stdcall WINRT_IMPL_CoCreateFreeThreadedMarshaler(void*, void** marshaler) noexcept
+    {
+        *marshaler = nullptr;
+        return winrt::impl::error_not_implemented;
+    }
+
+    inline int32_t __stdcall WINRT_IMPL_CoCreateInstance(winrt::guid const&, void*, uint32_t, winrt::guid const&, void** object) noexcept
+    {
+        *object = nullptr;
+        return winrt::impl::error_class_not_registered;
+    }
+
+    inline int32_t __stdcall WINRT_IMPL_CoGetCallContext(winrt::guid const&, void** object) noexcept
+    {
+        *object = nullptr;
+        return static_cast<int32_t>(0x80010117); // RPC_E_CALL_COMPLETE
+    }
+
+    inline int32_t __stdcall WINRT_IMPL_CoGetObjectContext(winrt::guid const&, void** object) noexcept
+    {
+        *object = nullptr;
+        return winrt::impl::error_not_implemented;
+    }
+
+    inline int32_t __stdcall WINRT_IMPL_CoGetApartmentType(int32_t* type, int32_t* qualifier) noexcept
+    {
+        *type = 1; // APTTYPE_MTA
+        *qualifier = 1; // APTTYPEQUALIFIER_IMPLICIT_MTA
+        return 0;
+    }
+
+    inline void* __stdcall WINRT_IMPL_CoTaskMemAlloc(std::size_t size) noexcept
+    {
+        return malloc(size);
+    }
+
+    inline void __stdcall WINRT_IMPL_CoTaskMemFree(void* ptr) noexcept
+    {
+        free(ptr);
+    }
+
+    inline winrt::impl::bstr __stdcall WINRT_IMPL_SysAllocString(wchar_t const* value) noexcept
+    {
+        if (!value)
+        {
+            return nullptr;
+        }
+
+        std::size_t const length = std::char_traits<wchar_t>::length(value);
+        auto result = static_cast<winrt::impl::portable_bstr*>(malloc(sizeof(winrt::impl::portable_bstr) + length * sizeof(wchar_t)));
+
+        if (!result)
+        {
+            return nullptr;
+        }
+
+        result->bytes = static_cast<uint32_t>(length * sizeof(wchar_t));
+        memcpy(result->value, value, (length + 1) * sizeof(wchar_t));
+        return result->value;
+    }
+
+    inline void __stdcall WINRT_IMPL_SysFreeString(winrt::impl::bstr string) noexcept
+    {
+        if (string)
+        {
+            free(reinterpret_cast<uint8_t*>(string) - offsetof(winrt::impl::portable_bstr, value));
+        }
+    }
+
+    inline uint32_t __stdcall WINRT_IMPL_SysStringLen(winrt::impl::bstr string) noexcept
+    {
+        if (!string)
+        {
+            return 0;
+        }
+
+        return reinterpret_cast<winrt::impl::portable_bstr*>(reinterpret_cast<uint8_t*>(string) - offsetof(winrt::impl::portable_bstr, value))->bytes / sizeof(wchar_t);
+    }
+
+    inline int32_t __stdcall WINRT_IMPL_IIDFromString(wchar_t const* string, winrt::guid* iid) noexcept
+    {
+        return winrt::impl::portable_parse_guid(string, *iid);
+    }
+
+    inline int32_t __stdcall WINRT_IMPL_MultiByteToWideChar(uint32_t codepage, uint32_t, char const* in_string, int32_t in_size, wchar_t* out_string, int32_t out_size) noexcept
+    {
+        return winrt::impl::portable_convert(codepage, in_string, in_size, out_string, out_size);
+    }
+
+    inline int32_t __stdcall WINRT_IMPL_WideCharToMultiByte(uint32_t codepage, uint32_t, wchar_t const* in_string, int32_t in_size, char* out_string, int32_t out_size, char const*, int32_t* default_used) noexcept
+    {
+        if (default_used)
+        {
+            *default_used = 0;
+        }
+
+        return winrt::impl::portable_convert(codepage, in_string, in_size, out_string, out_size);
+    }
+
+    inline void* __stdcall WINRT_IMPL_HeapAlloc(void*, uint32_t flags, size_t bytes) noexcept
+    {
+        return (flags & 0x8 /*HEAP_ZERO_MEMORY*/) ? calloc(1, bytes) : malloc(bytes);
+    }
+
+    inline int32_t __stdcall WINRT_IMPL_HeapFree(void*, uint32_t, void* value) noexcept
+    {
+        free(value);
+        return 1;
+    }
+
+    inline void* __stdcall WINRT_IMPL_GetProcessHeap() noexcept
+    {
+        return &winrt::impl::portable_kernel32;
+    }
+
+    inline uint32_t __stdcall WINRT_IMPL_FormatMessageW(uint32_t flags, void const*, uint32_t code, uint32_t, wchar_t* buffer, uint32_t size, va_list*) noexcept
+    {
+        auto const message = winrt::impl::portable_message(code);
+
+        if (message.empty())
+        {
+            return winrt::impl::portable_fail(317 /*ERROR_MR_MID_NOT_FOUND*/);
+        }
+
+        if (flags & 0x100 /*FORMAT_MESSAGE_ALLOCATE_BUFFER*/)
+        {
+            auto allocated = static_cast<wchar_t*>(malloc((message.size() + 1) * sizeof(wchar_t)));
+
+            if (!allocated)
+            {
+                return winrt::impl::portable_fail(8 /*ERROR_NOT_ENOUGH_MEMORY*/);
+            }
+
+            *reinterpret_cast<wchar_t**>(buffer) = allocated;
+            buffer = allocated;
+        }
+        else if (size <= message.size())
+        {
+            return winrt::impl::portable_fail(122 /*ERROR_INSUFFICIENT_BUFFER*/);
+        }
+
+        *std::copy(message.begin(), message.end(), buffer) = 0;
+        return static_cast<uint32_t>(message.size());
+    }
+
+    inline uint32_t __stdcall WINRT_IMPL_GetLastError() noexcept
+    {
+        return winrt::impl::portable_last_error;
+    }
+
+    inline void __stdcall WINRT_IMPL_GetSystemTimePreciseAsFileTime(void* result) noexcept
+    {
+        int64_t const value = winrt::impl::portable_filetime();
+        memcpy(result, &value, sizeof(value));
+    }
+
+    inline uintptr_t __stdcall WINRT_IMPL_VirtualQuery(void*, void*, uintptr_t) noexcept
+    {
+        return winrt::impl::portable_fail(50 /*ERROR_NOT_SUPPORTED*/);
+    }
+
+    inline void* __stdcall WINRT_IMPL_EncodePointer(void* ptr) noexcept
+    {
+        return ptr;
+    }
+
+    inline int32_t __stdcall WINRT_IMPL_OpenProcessToken(void*, uint32_t, void** token) noexcept
+    {
+        *token = nullptr;
+        return winrt::impl::portable_fail(50 /*ERROR_NOT_SUPPORTED*/);
+    }
+
+    inline void* __stdcall WINRT_IMPL_GetCurrentProcess() noexcept
+    {
+        return reinterpret_cast<void*>(-1);
+    }
+
+    inline int32_t __stdcall WINRT_IMPL_DuplicateToken(void*, uint32_t, void** duplicate) noexcept
+    {
+        *duplicate = nullptr;
+        return winrt::impl::portable_fail(50 /*ERROR_NOT_SUPPORTED*/);
+    }
+
+    inline int32_t __stdcall WINRT_IMPL_OpenThreadToken(void*, uint32_t, int32_t, void** token) noexcept
+    {
+        // The calling thread is never impersonating.
+        *token = nullptr;
+        return winrt::impl::portable_fail(1008 /*ERROR_NO_TOKEN*/);
+    }
+
+    inline void* __stdcall WINRT_IMPL_GetCurrentThread() noexcept
+    {
+        return reinterpret_cast<void*>(-2);
+    }
+
+    inline int32_t __stdcall WINRT_IMPL_SetThreadToken(void**, void* token) noexcept
+    {
+        return token ? winrt::impl::portable_fail(50 /*ERROR_NOT_SUPPORTED*/) : 1;
+    }
+
+    inline void __stdcall WINRT_IMPL_AcquireSRWLockExclusive(winrt::impl::srwlock* lock) noexcept
+    {
+        winrt::impl::portable_lock(lock, false);
+    }
+
+    inline void __stdcall WINRT_IMPL_AcquireSRWLockShared(winrt::impl::srwlock* lock) noexcept
+    {
+        winrt::impl::portable_lock(lock, true);
+    }
+
+    inline uint8_t __stdcall WINRT_IMPL_TryAcquireSRWLockExclusive(winrt::impl::srwlock* lock) noexcept
+    {
+        return winrt::impl::portable_try_lock(lock, false);
+    }
+
+    inline uint8_t __stdcall WINRT_IMPL_TryAcquireSRWLockShared(winrt::impl::srwlock* lock) noexcept
+    {
+        return winrt::impl::portable_try_lock(lock, true);
+    }
+
+    inline void __stdcall WINRT_IMPL_ReleaseSRWLockExclusive(winrt::impl::srwlock* lock) noexcept
+    {
+        winrt::impl::portable_unlock(lock, false);
+    }
+
+    inline void __stdcall WINRT_IMPL_ReleaseSRWLockShared(winrt::impl::srwlock* lock) noexcept
+    {
+        winrt::impl::portable_unlock(lock, true);
+    }
+
+    inline int32_t __stdcall WINRT_IMPL_SleepConditionVariableSRW(winrt::impl::condition_variable* cv, winrt::impl::srwlock* lock, uint32_t milliseconds, uint32_t flags) noexcept
+    {
+        return winrt::impl::portable_sleep(cv, lock, milliseconds, flags);
+    }
+
+    inline void __stdcall WINRT_IMPL_WakeConditionVariable(winrt::impl::condition_variable* cv) noexcept
+    {
+        winrt::impl::portable_notify(cv);
+    }
+
+    inline void __stdcall WINRT_IMPL_WakeAllConditionVariable(winrt::impl::condition_variable* cv) noexcept
+    {
+        winrt::impl::portable_notify(cv);
+    }
+
+    inline int32_t __stdcall WINRT_IMPL_WaitOnAddress(void volatile* address, void* compare, std::size_t size, uint32_t milliseconds) noexcept
+    {
+        return winrt::impl::portable_park(address, compare, size, winrt::impl::portable_deadline(milliseconds)) ? 1 : winrt::impl::portable_fail(1460 /*ERROR_TIMEOUT*/);
+    }
+
+    inline void __stdcall WINRT_IMPL_WakeByAddressAll(void* address) noexcept
+    {
+        winrt::impl::portable_unpark_all(address);
+    }
+
+    inline void* __stdcall WINRT_IMPL_InterlockedPushEntrySList(void* head, void* entry) noexcept
+    {
+        // The first word of the header and of each entry is the next pointer. Since entries are only ever pushed
+        // or flushed as a whole, a plain compare-exchange is free of ABA problems.
+        std::atomic_ref<void*> top(*static_cast<void**>(head));
+        void* next = top.load(std::memory_order_relaxed);
+
+        do
+        {
+            *static_cast<void**>(entry) = next;
+        }
+        while (!top.compare_exchange_weak(next, entry, std::memory_order_release, std::memory_order_relaxed));
+
+        return next;
+    }
+
+    inline void* __stdcall WINRT_IMPL_InterlockedFlushSList(void* head) noexcept
+    {
+        return std::atomic_ref<void*>(*static_cast<void**>(head)).exchange(nullptr, std::memory_order_acquire);
+    }
+
+    inline void* __stdcall WINRT_IMPL_CreateEventW(void*, int32_t manual_reset, int32_t initial_state, void*) noexcept
+    {
+        auto event = new (std::nothrow) winrt::impl::portable_event{ manual_reset != 0, initial_state != 0, {} };
+
+        if (!event)
+        {
+            winrt::impl::portable_fail(8 /*ERROR_NOT_ENOUGH_MEMORY*/);
+        }
+
+        return event;
+    }
+
+    inline int32_t __stdcall WINRT_IMPL_SetEvent(void* handle) noexcept
+    {
+        return winrt::impl::portable_set_event(handle);
+    }
+
+    inline int32_t __stdcall WINRT_IMPL_CloseHandle(void* hObject) noexcept
+    {
+        return winrt::impl::portable_close_handle(hObject);
+    }
+
+    inline uint32_t __stdcall WINRT_IMPL_WaitForSingleObject(void* handle, uint32_t milliseconds) noexcept
+    {
+        return winrt::impl::portable_wait_for(1, &handle, false, milliseconds);
+    }
+
+    inline uint32_t __stdcall WINRT_IMPL_WaitForMultipleObjects(uint32_t count, void* const* handles, int32_t wait_all, uint32_t milliseconds) noexcept
+    {
+        return winrt::impl::portable_wait_for(count, handles, wait_all != 0, milliseconds);
+    }
+
+    inline int32_t __stdcall WINRT_IMPL_TrySubmitThreadpoolCallback(void(__stdcall *callback)(void*, void* context), void* context, void* environment) noexcept
+    {
+        struct environment_prefix // The leading fields of TP_CALLBACK_ENVIRON
+        {
+            uint32_t version;
+            winrt::impl::portable_pool* pool;
+        };
+
+        auto pool = environment ? static_cast<environment_prefix*>(environment)->pool : nullptr;
+        return (pool ? *pool : winrt::impl::get_portable_pool()).submit(callback, context);
+    }
+
+    inline winrt::impl::ptp_timer __stdcall WINRT_IMPL_CreateThreadpoolTimer(void(__stdcall *callback)(void*, void* context, void*), void* context, void*) noexcept
+    {
+        auto timer = new (std::nothrow) winrt::impl::portable_threadpool_timer(callback, context);
+
+        if (!timer)
+        {
+            winrt::impl::portable_fail(8 /*ERROR_NOT_ENOUGH_MEMORY*/);
+        }
+
+        return reinterpret_cast<winrt::impl::ptp_timer>(timer);
+    }
+
+    inline void __stdcall WINRT_IMPL_SetThreadpoolTimer(winrt::impl::ptp_timer timer, void* time, uint32_t period, uint32_t) noexcept
+    {
+        reinterpret_cast<winrt::impl::portable_threadpool_timer*>(timer)->set(static_cast<int64_t const*>(time), period);
+    }
+
+    inline void __stdcall WINRT_IMPL_CloseThreadpoolTimer(winrt::impl::ptp_timer timer) noexcept
+    {
+        reinterpret_cast<winrt::impl::portable_threadpool_timer*>(timer)->close();
+    }
+
+    inline winrt::impl::ptp_wait __stdcall WINRT_IMPL_CreateThreadpoolWait(void(__stdcall *callback)(void*, void* context, void*, uint32_t result), void* context, void*) noexcept
+    {
+        auto wait = new (std::nothrow) winrt::impl::portable_threadpool_wait(callback, context);
+
+        if (!wait)
+        {
+            winrt::impl::portable_fail(8 /*ERROR_NOT_ENOUGH_MEMORY*/);
+        }
+
+        return reinterpret_cast<winrt::impl::ptp_wait>(wait);
+    }
+
+    inline void __stdcall WINRT_IMPL_SetThreadpoolWait(winrt::impl::ptp_wait wait, void* handle, void* timeout) noexcept
+    {
+        reinterpret_cast<winrt::impl::portable_threadpool_wait*>(wait)->set(handle, static_cast<int64_t const*>(timeout));
+    }
+
+    inline void __stdcall WINRT_IMPL_CloseThreadpoolWait(winrt::impl::ptp_wait wait) noexcept
+    {
+        reinterpret_cast<winrt::impl::portable_threadpool_wait*>(wait)->close();
+    }
+
+    // There is no overlapped I/O, so file_io and friends fail to start.
+    inline winrt::impl::ptp_io __stdcall WINRT_IMPL_CreateThreadpoolIo(void*, void(__stdcall *)(void*, void* context, void* overlapped, uint32_t result, std::size_t bytes, void*) noexcept, void*, void*) noexcept
+    {
+        winrt::impl::portable_fail(50 /*ERROR_NOT_SUPPORTED*/);
+        return nullptr;
+    }
+
+    inline void __stdcall WINRT_IMPL_StartThreadpoolIo(winrt::impl::ptp_io) noexcept
+    {
+    }
+
+    inline void __stdcall WINRT_IMPL_CancelThreadpoolIo(winrt::impl::ptp_io) noexcept
+    {
+    }
+
+    inline void __stdcall WINRT_IMPL_CloseThreadpoolIo(winrt::impl::ptp_io) noexcept
+    {
+    }
+
+    inline winrt::impl::ptp_pool __stdcall WINRT_IMPL_CreateThreadpool(void*) noexcept
+    {
+        auto pool = new (std::nothrow) winrt::impl::portable_pool();
+
+        if (!pool)
+        {
+            winrt::impl::portable_fail(8 /*ERROR_NOT_ENOUGH_MEMORY*/);
+        }
+
+        return reinterpret_cast<winrt::impl::ptp_pool>(pool);
+    }
+
+    inline void __stdcall WINRT_IMPL_SetThreadpoolThreadMaximum(winrt::impl::ptp_pool pool, uint32_t value) noexcept
+    {
+        reinterpret_cast<winrt::impl::portable_pool*>(pool)->maximum(value);
+    }
+
+    inline int32_t __stdcall WINRT_IMPL_SetThreadpoolThreadMinimum(winrt::impl::ptp_pool pool, uint32_t value) noexcept
+    {
+        return reinterpret_cast<winrt::impl::portable_pool*>(pool)->minimum(value);
+    }
+
+    inline void __stdcall WINRT_IMPL_CloseThreadpool(winrt::impl::ptp_pool pool) noexcept
+    {
+        reinterpret_cast<winrt::impl::portable_pool*>(pool)->close();
+    }
+}
+
+#endif
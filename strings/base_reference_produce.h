@@ -2,118 +2,364 @@
 namespace winrt::impl
 {
     template <typename T>
-    struct reference : implements<reference<T>, Windows::Foundation::IReference<T>, Windows::Foundation::IPropertyValue>
+    constexpr Windows::Foundation::PropertyType property_type() noexcept
+    {
+        using Windows::Foundation::PropertyType;
+
+        if constexpr (std::is_same_v<T, uint8_t>) { return PropertyType::UInt8; }
+        else if constexpr (std::is_same_v<T, int16_t>) { return PropertyType::Int16; }
+        else if constexpr (std::is_same_v<T, uint16_t>) { return PropertyType::UInt16; }
+        else if constexpr (std::is_same_v<T, int32_t>) { return PropertyType::Int32; }
+        else if constexpr (std::is_same_v<T, uint32_t>) { return PropertyType::UInt32; }
+        else if constexpr (std::is_same_v<T, int64_t>) { return PropertyType::Int64; }
+        else if constexpr (std::is_same_v<T, uint64_t>) { return PropertyType::UInt64; }
+        else if constexpr (std::is_same_v<T, float>) { return PropertyType::Single; }
+        else if constexpr (std::is_same_v<T, double>) { return PropertyType::Double; }
+        else if constexpr (std::is_same_v<T, char16_t>) { return PropertyType::Char16; }
+        else if constexpr (std::is_same_v<T, bool>) { return PropertyType::Boolean; }
+        else if constexpr (std::is_same_v<T, hstring>) { return PropertyType::String; }
+        else if constexpr (std::is_same_v<T, guid>) { return PropertyType::Guid; }
+        else if constexpr (std::is_same_v<T, Windows::Foundation::DateTime>) { return PropertyType::DateTime; }
+        else if constexpr (std::is_same_v<T, Windows::Foundation::TimeSpan>) { return PropertyType::TimeSpan; }
+        else if constexpr (std::is_same_v<T, Windows::Foundation::Point>) { return PropertyType::Point; }
+        else if constexpr (std::is_same_v<T, Windows::Foundation::Size>) { return PropertyType::Size; }
+        else if constexpr (std::is_same_v<T, Windows::Foundation::Rect>) { return PropertyType::Rect; }
+        else { return PropertyType::OtherType; }
+    }
+
+    template <typename T>
+    constexpr Windows::Foundation::PropertyType property_array_type() noexcept
     {
-        reference(T const& value) : m_value(value)
+        using Windows::Foundation::PropertyType;
+
+        if constexpr (std::is_same_v<T, Windows::Foundation::IInspectable>)
+        {
+            return PropertyType::InspectableArray;
+        }
+        else
         {
+            // Each array type is its element type plus 1024 (UInt8Array == UInt8 + 1024 and so on).
+            return static_cast<PropertyType>(static_cast<int32_t>(property_type<T>()) + 1024);
         }
+    }
 
-        T Value() const
+    // Mirrors the checks that PropertyValue makes when converting between numeric types: the value must be
+    // representable in the target type, so integers must be in range and floating-point values must also be whole.
+    template <typename To, typename From>
+    constexpr bool numeric_fits(From const value) noexcept
+    {
+        if constexpr (std::is_floating_point_v<To>)
+        {
+            if constexpr (std::is_floating_point_v<From> && sizeof(To) < sizeof(From))
+            {
+                constexpr From max = static_cast<From>(std::numeric_limits<To>::max());
+                return value != value || (value >= -max && value <= max) || value == std::numeric_limits<From>::infinity() || value == -std::numeric_limits<From>::infinity();
+            }
+            else
+            {
+                return true;
+            }
+        }
+        else if constexpr (std::is_floating_point_v<From>)
+        {
+            // The upper bound is a power of two and so is exact, unlike the maximum itself, which may round up.
+            constexpr From min = static_cast<From>(std::numeric_limits<To>::min());
+            constexpr From end = static_cast<From>(std::numeric_limits<To>::max() / 2 + 1) * 2;
+            return value >= min && value < end && static_cast<From>(static_cast<To>(value)) == value;
+        }
+        else if constexpr (std::is_signed_v<From> == std::is_signed_v<To>)
+        {
+            return value >= std::numeric_limits<To>::min() && value <= std::numeric_limits<To>::max();
+        }
+        else if constexpr (std::is_signed_v<From>)
+        {
+            return value >= 0 && static_cast<std::make_unsigned_t<From>>(value) <= std::numeric_limits<To>::max();
+        }
+        else
+        {
+            return value <= static_cast<std::make_unsigned_t<To>>(std::numeric_limits<To>::max());
+        }
+    }
+
+    template <typename Value, typename Element = Value>
+    struct property_value
+    {
+        explicit property_value(Value&& value) : m_value(std::move(value))
         {
-            return m_value;
         }
 
         Windows::Foundation::PropertyType Type() const noexcept
         {
-            return Windows::Foundation::PropertyType::OtherType;
+            if constexpr (std::is_same_v<Value, Element>)
+            {
+                return property_type<Value>();
+            }
+            else
+            {
+                return property_array_type<Element>();
+            }
         }
 
         static constexpr bool IsNumericScalar() noexcept
         {
-            return std::is_arithmetic_v<T> || std::is_enum_v<T>;
+            return (std::is_arithmetic_v<Value> && !std::is_same_v<Value, bool> && !std::is_same_v<Value, char16_t>) || std::is_enum_v<Value>;
+        }
+
+        uint8_t GetUInt8() const { return to_scalar<uint8_t>(); }
+        int16_t GetInt16() const { return to_scalar<int16_t>(); }
+        uint16_t GetUInt16() const { return to_scalar<uint16_t>(); }
+        int32_t GetInt32() const { return to_scalar<int32_t>(); }
+        uint32_t GetUInt32() const { return to_scalar<uint32_t>(); }
+        int64_t GetInt64() const { return to_scalar<int64_t>(); }
+        uint64_t GetUInt64() const { return to_scalar<uint64_t>(); }
+        float GetSingle() const { return to_scalar<float>(); }
+        double GetDouble() const { return to_scalar<double>(); }
+        char16_t GetChar16() const { return to_value<char16_t>(); }
+        bool GetBoolean() const { return to_value<bool>(); }
+        hstring GetString() const { return to_value<hstring>(); }
+        guid GetGuid() const { return to_value<guid>(); }
+        Windows::Foundation::DateTime GetDateTime() const { return to_value<Windows::Foundation::DateTime>(); }
+        Windows::Foundation::TimeSpan GetTimeSpan() const { return to_value<Windows::Foundation::TimeSpan>(); }
+        Windows::Foundation::Point GetPoint() const { return to_value<Windows::Foundation::Point>(); }
+        Windows::Foundation::Size GetSize() const { return to_value<Windows::Foundation::Size>(); }
+        Windows::Foundation::Rect GetRect() const { return to_value<Windows::Foundation::Rect>(); }
+        void GetUInt8Array(com_array<uint8_t>& value) const { value = to_array<uint8_t>(); }
+        void GetInt16Array(com_array<int16_t>& value) const { value = to_array<int16_t>(); }
+        void GetUInt16Array(com_array<uint16_t>& value) const { value = to_array<uint16_t>(); }
+        void GetInt32Array(com_array<int32_t>& value) const { value = to_array<int32_t>(); }
+        void GetUInt32Array(com_array<uint32_t>& value) const { value = to_array<uint32_t>(); }
+        void GetInt64Array(com_array<int64_t>& value) const { value = to_array<int64_t>(); }
+        void GetUInt64Array(com_array<uint64_t>& value) const { value = to_array<uint64_t>(); }
+        void GetSingleArray(com_array<float>& value) const { value = to_array<float>(); }
+        void GetDoubleArray(com_array<double>& value) const { value = to_array<double>(); }
+        void GetChar16Array(com_array<char16_t>& value) const { value = to_array<char16_t>(); }
+        void GetBooleanArray(com_array<bool>& value) const { value = to_array<bool>(); }
+        void GetStringArray(com_array<hstring>& value) const { value = to_array<hstring>(); }
+        void GetInspectableArray(com_array<Windows::Foundation::IInspectable>& value) const { value = to_array<Windows::Foundation::IInspectable>(); }
+        void GetGuidArray(com_array<guid>& value) const { value = to_array<guid>(); }
+        void GetDateTimeArray(com_array<Windows::Foundation::DateTime>& value) const { value = to_array<Windows::Foundation::DateTime>(); }
+        void GetTimeSpanArray(com_array<Windows::Foundation::TimeSpan>& value) const { value = to_array<Windows::Foundation::TimeSpan>(); }
+        void GetPointArray(com_array<Windows::Foundation::Point>& value) const { value = to_array<Windows::Foundation::Point>(); }
+        void GetSizeArray(com_array<Windows::Foundation::Size>& value) const { value = to_array<Windows::Foundation::Size>(); }
+        void GetRectArray(com_array<Windows::Foundation::Rect>& value) const { value = to_array<Windows::Foundation::Rect>(); }
+
+    protected:
+
+        Value m_value;
+
+    private:
+
+        template <typename To>
+        To to_scalar() const
+        {
+            if constexpr (IsNumericScalar())
+            {
+                auto const value = to_underlying();
+
+                if (!numeric_fits<To>(value))
+                {
+                    throw hresult_out_of_bounds();
+                }
+
+                return static_cast<To>(value);
+            }
+            else
+            {
+                throw hresult_error(error_type_mismatch);
+            }
         }
 
-        uint8_t GetUInt8() const
+        auto to_underlying() const noexcept
         {
-            return to_scalar<uint8_t>();
+            if constexpr (std::is_enum_v<Value>)
+            {
+                return static_cast<std::underlying_type_t<Value>>(m_value);
+            }
+            else
+            {
+                return m_value;
+            }
         }
 
-        int16_t GetInt16() const
+        template <typename To>
+        To to_value() const
         {
-            return to_scalar<int16_t>();
+            if constexpr (std::is_same_v<Value, To>)
+            {
+                return m_value;
+            }
+            else
+            {
+                throw hresult_error(error_type_mismatch);
+            }
         }
 
-        uint16_t GetUInt16() const
+        template <typename To>
+        com_array<To> to_array() const
         {
-            return to_scalar<uint16_t>();
+            if constexpr (std::is_same_v<Value, com_array<To>>)
+            {
+                return com_array<To>(m_value.begin(), m_value.end());
+            }
+            else
+            {
+                throw hresult_error(error_type_mismatch);
+            }
         }
+    };
 
-        int32_t GetInt32() const
+    template <typename T>
+    struct reference : implements<reference<T>, Windows::Foundation::IReference<T>, Windows::Foundation::IPropertyValue>,
+        property_value<T>
+    {
+        reference(T const& value) : property_value<T>(T(value))
         {
-            return to_scalar<int32_t>();
         }
 
-        uint32_t GetUInt32() const
+        T Value() const
         {
-            return to_scalar<uint32_t>();
+            return this->m_value;
         }
+    };
 
-        int64_t GetInt64() const
+    template <typename T>
+    struct reference_array : implements<reference_array<T>, Windows::Foundation::IReferenceArray<T>, Windows::Foundation::IPropertyValue>,
+        property_value<com_array<T>, T>
+    {
+        reference_array(array_view<T const> const& value) : property_value<com_array<T>, T>(com_array<T>(value.begin(), value.end()))
         {
-            return to_scalar<int64_t>();
         }
 
-        uint64_t GetUInt64() const
+        com_array<T> Value() const
         {
-            return to_scalar<uint64_t>();
+            return com_array<T>(this->m_value.begin(), this->m_value.end());
         }
+    };
 
-        float GetSingle() { throw hresult_not_implemented(); }
-        double GetDouble() { throw hresult_not_implemented(); }
-        char16_t GetChar16() { throw hresult_not_implemented(); }
-        bool GetBoolean() { throw hresult_not_implemented(); }
-        hstring GetString() { throw hresult_not_implemented(); }
-        guid GetGuid() { throw hresult_not_implemented(); }
-        Windows::Foundation::DateTime GetDateTime() { throw hresult_not_implemented(); }
-        Windows::Foundation::TimeSpan GetTimeSpan() { throw hresult_not_implemented(); }
-        Windows::Foundation::Point GetPoint() { throw hresult_not_implemented(); }
-        Windows::Foundation::Size GetSize() { throw hresult_not_implemented(); }
-        Windows::Foundation::Rect GetRect() { throw hresult_not_implemented(); }
-        void GetUInt8Array(com_array<uint8_t> &) { throw hresult_not_implemented(); }
-        void GetInt16Array(com_array<int16_t> &) { throw hresult_not_implemented(); }
-        void GetUInt16Array(com_array<uint16_t> &) { throw hresult_not_implemented(); }
-        void GetInt32Array(com_array<int32_t> &) { throw hresult_not_implemented(); }
-        void GetUInt32Array(com_array<uint32_t> &) { throw hresult_not_implemented(); }
-        void GetInt64Array(com_array<int64_t> &) { throw hresult_not_implemented(); }
-        void GetUInt64Array(com_array<uint64_t> &) { throw hresult_not_implemented(); }
-        void GetSingleArray(com_array<float> &) { throw hresult_not_implemented(); }
-        void GetDoubleArray(com_array<double> &) { throw hresult_not_implemented(); }
-        void GetChar16Array(com_array<char16_t> &) { throw hresult_not_implemented(); }
-        void GetBooleanArray(com_array<bool> &) { throw hresult_not_implemented(); }
-        void GetStringArray(com_array<hstring> &) { throw hresult_not_implemented(); }
-        void GetInspectableArray(com_array<Windows::Foundation::IInspectable> &) { throw hresult_not_implemented(); }
-        void GetGuidArray(com_array<guid> &) { throw hresult_not_implemented(); }
-        void GetDateTimeArray(com_array<Windows::Foundation::DateTime> &) { throw hresult_not_implemented(); }
-        void GetTimeSpanArray(com_array<Windows::Foundation::TimeSpan> &) { throw hresult_not_implemented(); }
-        void GetPointArray(com_array<Windows::Foundation::Point> &) { throw hresult_not_implemented(); }
-        void GetSizeArray(com_array<Windows::Foundation::Size> &) { throw hresult_not_implemented(); }
-        void GetRectArray(com_array<Windows::Foundation::Rect> &) { throw hresult_not_implemented(); }
+    // Local boxes are recorded by vtable when the first one of each type is created, so that unboxing can
+    // recognize them and read their values directly instead of calling QueryInterface and Value.
+    template <typename T>
+    struct local_box
+    {
+        std::atomic<void const*> vtable{ nullptr };
+        T(*read)(void* abi){ nullptr };
+    };
 
-    private:
+    template <typename T>
+    inline local_box<T> local_boxes;
 
-        template <typename To>
-        To to_scalar() const
+    template <typename D>
+    auto read_local_box(void* abi)
+    {
+        using I = typename implements_default_interface<D>::type;
+        return static_cast<produce<D, I>*>(static_cast<abi_t<I>*>(abi))->shim().Value();
+    }
+
+    template <typename D, typename I>
+    I record_local_box(I&& object)
+    {
+        using T = decltype(read_local_box<D>(nullptr));
+
+        [[maybe_unused]] static bool const recorded = [&]
         {
-            if constexpr (IsNumericScalar())
+            auto& box = local_boxes<T>;
+            box.read = read_local_box<D>;
+            box.vtable.store(*static_cast<void const* const*>(get_abi(object)), std::memory_order_release);
+            return true;
+        }();
+
+        return std::move(object);
+    }
+
+    template <typename T>
+    std::optional<T> get_local_box(void* abi)
+    {
+        if (abi)
+        {
+            auto& box = local_boxes<T>;
+
+            if (box.vtable.load(std::memory_order_acquire) == *static_cast<void const* const*>(abi))
             {
-                return static_cast<To>(m_value);
+                return box.read(abi);
             }
-            else
+        }
+
+        return std::nullopt;
+    }
+
+    template <typename T>
+    Windows::Foundation::IReference<T> make_reference(T const& value)
+    {
+        // The values boxed most often are created once and kept for the life of the process. Like any other
+        // object they hold the module lock, so a component DLL would never unload and is left without the cache.
+#ifndef _WINDLL
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            static auto const cache = new Windows::Foundation::IReference<bool>[2]{ record_local_box<reference<T>>(make<reference<T>>(false)), record_local_box<reference<T>>(make<reference<T>>(true)) };
+            return cache[value];
+        }
+        else if constexpr (std::is_same_v<T, hstring>)
+        {
+            if (value.empty())
             {
-                throw hresult_not_implemented();
+                static auto const cache = new Windows::Foundation::IReference<hstring>(record_local_box<reference<T>>(make<reference<T>>(value)));
+                return *cache;
             }
         }
+        else if constexpr (std::is_integral_v<T> && !std::is_same_v<T, char16_t>)
+        {
+            constexpr uint32_t cache_size{ 16 };
 
-        T m_value;
-    };
+            if (static_cast<std::make_unsigned_t<T>>(value) < cache_size)
+            {
+                static auto const cache = []
+                {
+                    auto cache = new Windows::Foundation::IReference<T>[cache_size];
+
+                    for (uint32_t index = 0; index < cache_size; ++index)
+                    {
+                        cache[index] = record_local_box<reference<T>>(make<reference<T>>(static_cast<T>(index)));
+                    }
+
+                    return cache;
+                }();
+
+                return cache[value];
+            }
+        }
+#endif
+
+        return record_local_box<reference<T>>(make<reference<T>>(value));
+    }
+
+    template <typename T>
+    Windows::Foundation::IReferenceArray<T> make_reference_array(array_view<T const> const& value)
+    {
+        return record_local_box<reference_array<T>>(make<reference_array<T>>(value));
+    }
 
     template <typename T>
     struct reference_traits
     {
-        static auto make(T const& value) { return winrt::make<impl::reference<T>>(value); }
+        static auto make(T const& value) { return make_reference(value); }
         using itf = Windows::Foundation::IReference<T>;
     };
 
+    template <>
+    struct reference_traits<Windows::Foundation::IInspectable>
+    {
+        static auto make(Windows::Foundation::IInspectable const& value) { return Windows::Foundation::PropertyValue::CreateInspectable(value); }
+        using itf = Windows::Foundation::IInspectable;
+    };
+
+#ifdef WINRT_LOCAL_BOXING
+    template <typename T>
+    struct reference_traits<com_array<T>>
+    {
+        static auto make(array_view<T const> const& value) { return make_reference_array(value); }
+        using itf = Windows::Foundation::IReferenceArray<T>;
+    };
+#else
     template <>
     struct reference_traits<uint8_t>
     {
@@ -198,13 +444,6 @@ namespace winrt::impl
         using itf = Windows::Foundation::IReference<hstring>;
     };
 
-    template <>
-    struct reference_traits<Windows::Foundation::IInspectable>
-    {
-        static auto make(Windows::Foundation::IInspectable const& value) { return Windows::Foundation::PropertyValue::CreateInspectable(value); }
-        using itf = Windows::Foundation::IInspectable;
-    };
-
     template <>
     struct reference_traits<guid>
     {
@@ -212,13 +451,6 @@ namespace winrt::impl
         using itf = Windows::Foundation::IReference<guid>;
     };
 
-    template <>
-    struct reference_traits<GUID>
-    {
-        static auto make(GUID const& value) { return Windows::Foundation::PropertyValue::CreateGuid(reinterpret_cast<guid const&>(value)); }
-        using itf = Windows::Foundation::IReference<guid>;
-    };
-
     template <>
     struct reference_traits<Windows::Foundation::DateTime>
     {
@@ -352,13 +584,6 @@ namespace winrt::impl
         using itf = Windows::Foundation::IReferenceArray<guid>;
     };
 
-    template <>
-    struct reference_traits<com_array<GUID>>
-    {
-        static auto make(array_view<GUID const> const& value) { return Windows::Foundation::PropertyValue::CreateGuidArray(reinterpret_cast<array_view<guid const> const&>(value)); }
-        using itf = Windows::Foundation::IReferenceArray<guid>;
-    };
-
     template <>
     struct reference_traits<com_array<Windows::Foundation::DateTime>>
     {
@@ -393,6 +618,21 @@ namespace winrt::impl
         static auto make(array_view<Windows::Foundation::Rect const> const& value) { return Windows::Foundation::PropertyValue::CreateRectArray(value); }
         using itf = Windows::Foundation::IReferenceArray<Windows::Foundation::Rect>;
     };
+#endif
+
+    template <>
+    struct reference_traits<GUID>
+    {
+        static auto make(GUID const& value) { return reference_traits<guid>::make(reinterpret_cast<guid const&>(value)); }
+        using itf = Windows::Foundation::IReference<guid>;
+    };
+
+    template <>
+    struct reference_traits<com_array<GUID>>
+    {
+        static auto make(array_view<GUID const> const& value) { return reference_traits<com_array<guid>>::make(reinterpret_cast<array_view<guid const> const&>(value)); }
+        using itf = Windows::Foundation::IReferenceArray<guid>;
+    };
 }
 
 WINRT_EXPORT namespace winrt::Windows::Foundation
@@ -431,7 +671,15 @@ namespace winrt::impl
         }
         if constexpr (std::is_enum_v<T>)
         {
-            if (auto temp = value.template try_as<Windows::Foundation::IReference<T>>())
+            if (auto local = get_local_box<T>(get_abi(value)))
+            {
+                return *local;
+            }
+            else if (auto local_underlying = get_local_box<std::underlying_type_t<T>>(get_abi(value)))
+            {
+                return static_cast<T>(*local_underlying);
+            }
+            else if (auto temp = value.template try_as<Windows::Foundation::IReference<T>>())
             {
                 return temp.Value();
             }
@@ -443,11 +691,25 @@ namespace winrt::impl
         else if constexpr (std::is_same_v<T, com_array<GUID>>)
         {
             T result;
-            reinterpret_cast<com_array<guid>&>(result) = value.template as<typename impl::reference_traits<T>::itf>().Value();
+
+            if (auto local = get_local_box<com_array<guid>>(get_abi(value)))
+            {
+                reinterpret_cast<com_array<guid>&>(result) = std::move(*local);
+            }
+            else
+            {
+                reinterpret_cast<com_array<guid>&>(result) = value.template as<typename impl::reference_traits<T>::itf>().Value();
+            }
+
             return result;
         }
         else
         {
+            if (auto local = get_local_box<std::conditional_t<std::is_same_v<T, GUID>, guid, T>>(get_abi(value)))
+            {
+                return std::move(*local);
+            }
+
             return value.template as<typename impl::reference_traits<T>::itf>().Value();
         }
     }
@@ -457,6 +719,16 @@ namespace winrt::impl
     {
         if constexpr (std::is_enum_v<T>)
         {
+            if (auto local = get_local_box<T>(get_abi(value)))
+            {
+                return *local;
+            }
+
+            if (auto local = get_local_box<std::underlying_type_t<T>>(get_abi(value)))
+            {
+                return static_cast<T>(*local);
+            }
+
             if (auto temp = value.template try_as<Windows::Foundation::IReference<T>>())
             {
                 return temp.Value();
@@ -469,6 +741,13 @@ namespace winrt::impl
         }
         else if constexpr (std::is_same_v<T, com_array<GUID>>)
         {
+            if (auto local = get_local_box<com_array<guid>>(get_abi(value)))
+            {
+                T result;
+                reinterpret_cast<com_array<guid>&>(result) = std::move(*local);
+                return result;
+            }
+
             if (auto temp = value.template try_as<typename impl::reference_traits<T>::itf>())
             {
                 T result;
@@ -478,6 +757,11 @@ namespace winrt::impl
         }
         else
         {
+            if (auto local = get_local_box<std::conditional_t<std::is_same_v<T, GUID>, guid, T>>(get_abi(value)))
+            {
+                return std::move(*local);
+            }
+
             if (auto temp = value.template try_as<typename impl::reference_traits<T>::itf>())
             {
                 return temp.Value();
@@ -545,6 +829,11 @@ WINRT_EXPORT namespace winrt
     {
         if (value)
         {
+            if (auto local = impl::get_local_box<hstring>(get_abi(value)))
+            {
+                return std::move(*local);
+            }
+
             if (auto temp = value.try_as<Windows::Foundation::IReference<hstring>>())
             {
                 return temp.Value();
@@ -1,6 +1,33 @@
 
 namespace winrt::impl
 {
+    // The bounds-checked Annex K functions are only reliably available on Windows, and defining them elsewhere
+    // could clash with other declarations of the same names, so the runtime support calls these instead.
+    inline int WINRT_IMPL_memcpy_s(void* destination, size_t const destination_size, void const* source, size_t const count) noexcept
+    {
+#ifdef _WIN32
+        return ::memcpy_s(destination, destination_size, source, count);
+#else
+        if (count > destination_size)
+        {
+            return 34; // ERANGE
+        }
+
+        memcpy(destination, source, count);
+        return 0;
+#endif
+    }
+
+    template <size_t Size, typename... Args>
+    int WINRT_IMPL_swprintf_s(wchar_t(&buffer)[Size], wchar_t const* format, Args... args) noexcept
+    {
+#ifdef _WIN32
+        return ::swprintf_s(buffer, Size, format, args...);
+#else
+        return swprintf(buffer, Size, format, args...);
+#endif
+    }
+
     struct atomic_ref_count
     {
         atomic_ref_count() noexcept = default;
@@ -105,7 +132,7 @@ namespace winrt::impl
         }
 
         auto header = precreate_hstring_on_heap(length);
-        memcpy_s(header->buffer, sizeof(wchar_t) * length, value, sizeof(wchar_t) * length);
+        WINRT_IMPL_memcpy_s(header->buffer, sizeof(wchar_t) * length, value, sizeof(wchar_t) * length);
         return header;
     }
 
@@ -640,7 +667,7 @@ WINRT_EXPORT namespace winrt
     {
         wchar_t buffer[40];
         //{00000000-0000-0000-0000-000000000000}
-        swprintf_s(buffer, L"{%08x-%04hx-%04hx-%02hhx%02hhx-%02hhx%02hhx%02hhx%02hhx%02hhx%02hhx}",
+        impl::WINRT_IMPL_swprintf_s(buffer, L"{%08x-%04hx-%04hx-%02hhx%02hhx-%02hhx%02hhx%02hhx%02hhx%02hhx%02hhx}",
             value.Data1, value.Data2, value.Data3, value.Data4[0], value.Data4[1],
             value.Data4[2], value.Data4[3], value.Data4[4], value.Data4[5], value.Data4[6], value.Data4[7]);
         return hstring{ buffer };
@@ -4,13 +4,13 @@ extern "C"
 __declspec(selectany)
 char const * const WINRT_version = "C++/WinRT version:" CPPWINRT_VERSION;
 
+#if defined(_MSC_VER)
 #ifdef _M_IX86
 #pragma comment(linker, "/include:_WINRT_version")
 #else
 #pragma comment(linker, "/include:WINRT_version")
 #endif
 
-#if defined(_MSC_VER)
 #pragma detect_mismatch("C++/WinRT version", CPPWINRT_VERSION)
 #endif
 
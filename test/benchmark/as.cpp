@@ -0,0 +1,46 @@
+#include "pch.h"
+
+using namespace winrt;
+using namespace Windows::Foundation;
+
+namespace
+{
+    struct Many : implements<Many, IStringable, IClosable, IWwwFormUrlDecoderEntry, IUriEscapeStatics, IGuidHelperStatics, IDeferralFactory>
+    {
+        hstring ToString() { return {}; }
+        void Close() {}
+        hstring Name() { return {}; }
+        hstring Value() { return {}; }
+        hstring UnescapeComponent(hstring const&) { return {}; }
+        hstring EscapeComponent(hstring const&) { return {}; }
+        guid CreateNewGuid() { return {}; }
+        guid Empty() { return {}; }
+        bool Equals(guid const&, guid const&) { return true; }
+        Deferral Create(DeferralCompletedHandler const&) { return nullptr; }
+    };
+}
+
+TEST_CASE("as")
+{
+    IStringable const object = make<Many>();
+
+    BENCHMARK("first")
+    {
+        return object.as<IStringable>();
+    };
+
+    BENCHMARK("last")
+    {
+        return object.as<IDeferralFactory>();
+    };
+
+    BENCHMARK("try_as, hit")
+    {
+        return object.try_as<IGuidHelperStatics>();
+    };
+
+    BENCHMARK("try_as, miss")
+    {
+        return object.try_as<IAsyncAction>();
+    };
+}
@@ -0,0 +1,35 @@
+#include "pch.h"
+
+using namespace winrt;
+using namespace Windows::Foundation;
+
+TEST_CASE("box")
+{
+    IInspectable const integer = box_value(123);
+    IInspectable const string = box_value(L"value");
+
+    BENCHMARK("box_value, int32_t")
+    {
+        return box_value(123);
+    };
+
+    BENCHMARK("box_value, hstring")
+    {
+        return box_value(L"value");
+    };
+
+    BENCHMARK("unbox_value, int32_t")
+    {
+        return unbox_value<int32_t>(integer);
+    };
+
+    BENCHMARK("unbox_value, hstring")
+    {
+        return unbox_value<hstring>(string);
+    };
+
+    BENCHMARK("unbox_value_or, mismatch")
+    {
+        return unbox_value_or<int32_t>(string, 0);
+    };
+}
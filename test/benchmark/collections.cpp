@@ -0,0 +1,72 @@
+#include "pch.h"
+
+using namespace winrt;
+using namespace Windows::Foundation;
+using namespace Windows::Foundation::Collections;
+
+namespace
+{
+    template <typename Vector>
+    void vector_benchmarks(std::string const& name, Vector const& values)
+    {
+        std::array<int, 100> buffer{};
+
+        BENCHMARK(name + " GetAt")
+        {
+            return values.GetAt(500);
+        };
+
+        BENCHMARK(name + " GetMany, 100")
+        {
+            return values.GetMany(0, buffer);
+        };
+
+        BENCHMARK(name + " iteration, 1000")
+        {
+            int total{};
+
+            for (int value : values)
+            {
+                total += value;
+            }
+
+            return total;
+        };
+    }
+}
+
+TEST_CASE("collections")
+{
+    std::vector<int> source(1000);
+    std::iota(source.begin(), source.end(), 0);
+
+    vector_benchmarks("single_threaded_vector", single_threaded_vector<int>(std::vector<int>(source)));
+    vector_benchmarks("multi_threaded_vector", multi_threaded_vector<int>(std::vector<int>(source)));
+    vector_benchmarks("IVectorView", single_threaded_vector<int>(std::vector<int>(source)).GetView());
+
+    std::map<int, int> pairs;
+
+    for (int value : source)
+    {
+        pairs.emplace(value, value);
+    }
+
+    auto const map = single_threaded_map<int, int>(std::move(pairs));
+
+    BENCHMARK("single_threaded_map Lookup")
+    {
+        return map.Lookup(500);
+    };
+
+    BENCHMARK("single_threaded_map iteration, 1000")
+    {
+        int total{};
+
+        for (auto&& pair : map)
+        {
+            total += pair.Value();
+        }
+
+        return total;
+    };
+}
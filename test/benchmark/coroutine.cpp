@@ -0,0 +1,50 @@
+#include "pch.h"
+
+using namespace winrt;
+using namespace Windows::Foundation;
+
+namespace
+{
+    IAsyncAction action()
+    {
+        co_return;
+    }
+
+    IAsyncOperation<int> operation()
+    {
+        co_return 1;
+    }
+
+    IAsyncAction nested()
+    {
+        co_await action();
+    }
+
+    IAsyncAction background()
+    {
+        co_await resume_background();
+    }
+}
+
+TEST_CASE("coroutine")
+{
+    BENCHMARK("IAsyncAction")
+    {
+        action().get();
+    };
+
+    BENCHMARK("IAsyncOperation")
+    {
+        return operation().get();
+    };
+
+    BENCHMARK("co_await completed")
+    {
+        nested().get();
+    };
+
+    BENCHMARK("resume_background round trip")
+    {
+        background().get();
+    };
+}
@@ -0,0 +1,36 @@
+#include "pch.h"
+
+using namespace winrt;
+using namespace Windows::Foundation;
+
+TEST_CASE("event")
+{
+    for (uint32_t const count : { 1, 4, 16, 64 })
+    {
+        std::string const suffix = ", " + std::to_string(count) + " handlers";
+        event<EventHandler<int>> source;
+        std::vector<event_token> tokens;
+        int total{};
+
+        for (uint32_t handler = 0; handler < count; ++handler)
+        {
+            tokens.push_back(source.add([&](auto&&, int value) { total += value; }));
+        }
+
+        BENCHMARK("raise" + suffix)
+        {
+            source(nullptr, 1);
+            return total;
+        };
+
+        BENCHMARK("add and remove" + suffix)
+        {
+            source.remove(source.add([](auto&&, int) {}));
+        };
+
+        for (auto&& token : tokens)
+        {
+            source.remove(token);
+        }
+    }
+}
@@ -0,0 +1,69 @@
+#include "pch.h"
+
+using namespace winrt;
+
+namespace
+{
+    void* marshal(param::hstring const& value) noexcept
+    {
+        return get_abi(static_cast<hstring const&>(value));
+    }
+}
+
+TEST_CASE("hstring")
+{
+    std::wstring_view const short_value{ L"Windows.Foundation.Uri" };
+    std::wstring const long_value(1000, L'x');
+    hstring const value{ short_value };
+
+    BENCHMARK("create")
+    {
+        return hstring{ short_value };
+    };
+
+    BENCHMARK("create, long")
+    {
+        return hstring{ long_value };
+    };
+
+    BENCHMARK("copy")
+    {
+        return hstring{ value };
+    };
+
+    BENCHMARK("hash")
+    {
+        return std::hash<hstring>{}(value);
+    };
+
+    BENCHMARK("compare")
+    {
+        return value == short_value;
+    };
+}
+
+TEST_CASE("param::hstring")
+{
+    std::wstring const string{ L"Windows.Foundation.Uri" };
+    hstring const value{ string };
+
+    BENCHMARK("hstring")
+    {
+        return marshal(value);
+    };
+
+    BENCHMARK("wstring_view")
+    {
+        return marshal(std::wstring_view{ string });
+    };
+
+    BENCHMARK("wstring")
+    {
+        return marshal(string);
+    };
+
+    BENCHMARK("wchar_t const*")
+    {
+        return marshal(string.c_str());
+    };
+}
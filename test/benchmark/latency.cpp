@@ -0,0 +1,352 @@
+#include "pch.h"
+#include "latency.h"
+#include "winrt/Windows.System.h"
+
+using namespace winrt;
+using namespace Windows::Foundation;
+using namespace Windows::System;
+
+// These take several seconds, so they are hidden and run with "benchmark [latency]".
+
+std::vector<latency_result>& latency_results()
+{
+    static std::vector<latency_result> results;
+    return results;
+}
+
+void report_latency(std::string const& name, std::vector<double> samples)
+{
+    std::sort(samples.begin(), samples.end());
+
+    latency_result result;
+    result.name = name;
+    result.samples = static_cast<uint32_t>(samples.size());
+    result.min = percentile(samples, 0.0);
+    result.p50 = percentile(samples, 0.5);
+    result.p90 = percentile(samples, 0.9);
+    result.p99 = percentile(samples, 0.99);
+    result.p999 = percentile(samples, 0.999);
+    result.max = percentile(samples, 1.0);
+
+    Catch::cout() << result.name << ": " << result.samples << " samples, p50 " << result.p50 << "ns, p90 " << result.p90
+        << "ns, p99 " << result.p99 << "ns, p99.9 " << result.p999 << "ns, max " << result.max << "ns\n";
+
+    latency_results().push_back(result);
+}
+
+namespace
+{
+    constexpr uint32_t sample_count{ 10000 };
+    constexpr uint32_t timer_sample_count{ 200 };
+
+    IAsyncOperation<int> completed()
+    {
+        co_return 1;
+    }
+
+    IAsyncOperation<int> pending(HANDLE signal)
+    {
+        co_await resume_on_signal(signal);
+        co_return 1;
+    }
+
+    IAsyncOperation<int> pending(HANDLE signal, latency_clock::time_point& completed)
+    {
+        co_await resume_on_signal(signal);
+        completed = latency_clock::now();
+        co_return 1;
+    }
+
+    // Waits on an event that is never signaled, so it only finishes when canceled.
+    IAsyncOperation<int> never(HANDLE unsignaled)
+    {
+        auto cancel = co_await get_cancellation_token();
+        cancel.enable_propagation();
+        co_await resume_on_signal(unsignaled);
+        co_return 1;
+    }
+
+    IAsyncOperation<int> nested_never(HANDLE unsignaled)
+    {
+        auto cancel = co_await get_cancellation_token();
+        cancel.enable_propagation();
+        co_return co_await never(unsignaled);
+    }
+
+    // The coroutine runs synchronously up to the co_await, so the caller regains control only once the awaiter has
+    // either finished or registered its completion handler.
+    template <typename Async>
+    IAsyncAction await_timed(Async const async, latency_clock::time_point& started, latency_clock::time_point& resumed)
+    {
+        started = latency_clock::now();
+        co_await async;
+        resumed = latency_clock::now();
+    }
+
+    template <typename Async>
+    IAsyncAction await_canceled(Async const async, latency_clock::time_point& resumed)
+    {
+        try
+        {
+            co_await async;
+        }
+        catch (hresult_canceled const&)
+        {
+        }
+
+        resumed = latency_clock::now();
+    }
+
+    IAsyncAction hops(uint32_t const count, std::vector<double>& samples)
+    {
+        co_await resume_background();
+
+        for (uint32_t index = 0; index < count; ++index)
+        {
+            auto const start = latency_clock::now();
+            co_await resume_background();
+            samples.push_back(to_nanoseconds(latency_clock::now() - start));
+        }
+    }
+
+    fire_and_forget ping(HANDLE pong)
+    {
+        co_await resume_background();
+        SetEvent(pong);
+    }
+
+    IAsyncAction delayed(TimeSpan const duration, latency_clock::duration& lateness)
+    {
+        auto const start = latency_clock::now();
+        co_await resume_after(duration);
+        lateness = latency_clock::now() - start - std::chrono::duration_cast<latency_clock::duration>(duration);
+    }
+
+    IAsyncAction switch_apartments(DispatcherQueue const queue, uint32_t const count, std::vector<double>& mta, std::vector<double>& to_sta, std::vector<double>& to_mta)
+    {
+        co_await resume_foreground(queue);
+        apartment_context sta;
+        co_await resume_background();
+        apartment_context background;
+
+        for (uint32_t index = 0; index < count; ++index)
+        {
+            co_await resume_background();
+            auto start = latency_clock::now();
+            co_await background;
+            mta.push_back(to_nanoseconds(latency_clock::now() - start));
+
+            start = latency_clock::now();
+            co_await sta;
+            to_sta.push_back(to_nanoseconds(latency_clock::now() - start));
+
+            start = latency_clock::now();
+            co_await background;
+            to_mta.push_back(to_nanoseconds(latency_clock::now() - start));
+        }
+    }
+
+    template <typename Async, size_t... Index>
+    auto when_all_of(std::array<Async, sizeof...(Index)> const& async, std::index_sequence<Index...>)
+    {
+        return when_all(async[Index]...);
+    }
+
+    template <typename Async, size_t... Index>
+    auto when_any_of(std::array<Async, sizeof...(Index)> const& async, std::index_sequence<Index...>)
+    {
+        return when_any(async[Index]...);
+    }
+
+    // Times when_all and when_any over Count operations that have either already completed or all wait on the same
+    // manual-reset event, in which case the latency runs from setting the event to resuming the awaiter.
+    template <size_t Count>
+    void measure_when(handle const& signal)
+    {
+        auto const suffix = " of " + std::to_string(Count);
+        std::array<IAsyncOperation<int>, Count> operations;
+
+        auto start_completed = [&]
+        {
+            for (auto&& operation : operations)
+            {
+                operation = completed();
+            }
+        };
+
+        auto start_pending = [&]
+        {
+            for (auto&& operation : operations)
+            {
+                operation = pending(signal.get());
+            }
+        };
+
+        auto finish_pending = [&]
+        {
+            for (auto&& operation : operations)
+            {
+                operation.get();
+            }
+
+            ResetEvent(signal.get());
+        };
+
+        measure_latency("when_all completed" + suffix, sample_count / Count, [&]
+        {
+            start_completed();
+            auto const start = latency_clock::now();
+            when_all_of(operations, std::make_index_sequence<Count>()).get();
+            return latency_clock::now() - start;
+        });
+
+        measure_latency("when_any completed" + suffix, sample_count / Count, [&]
+        {
+            start_completed();
+            auto const start = latency_clock::now();
+            when_any_of(operations, std::make_index_sequence<Count>()).get();
+            return latency_clock::now() - start;
+        });
+
+        measure_latency("when_all signaled" + suffix, sample_count / Count, [&]
+        {
+            start_pending();
+            latency_clock::time_point started;
+            latency_clock::time_point resumed;
+            auto awaiter = await_timed(when_all_of(operations, std::make_index_sequence<Count>()), started, resumed);
+            auto const signaled = latency_clock::now();
+            SetEvent(signal.get());
+            awaiter.get();
+            finish_pending();
+            return resumed - signaled;
+        });
+
+        measure_latency("when_any signaled" + suffix, sample_count / Count, [&]
+        {
+            start_pending();
+            latency_clock::time_point started;
+            latency_clock::time_point resumed;
+            auto awaiter = await_timed(when_any_of(operations, std::make_index_sequence<Count>()), started, resumed);
+            auto const signaled = latency_clock::now();
+            SetEvent(signal.get());
+            awaiter.get();
+            finish_pending();
+            return resumed - signaled;
+        });
+    }
+}
+
+TEST_CASE("latency, co_await", "[.][latency]")
+{
+    measure_latency("co_await completed IAsyncOperation", sample_count, []
+    {
+        auto operation = completed();
+        latency_clock::time_point started;
+        latency_clock::time_point resumed;
+        await_timed(operation, started, resumed).get();
+        return resumed - started;
+    });
+
+    handle signal{ check_pointer(CreateEventW(nullptr, false, false, nullptr)) };
+
+    // From the operation's co_return to the awaiter running again, which covers the completion handler and the
+    // await_adapter but not the thread pool wait that completes the operation.
+    measure_latency("co_await pending IAsyncOperation", sample_count, [&]
+    {
+        latency_clock::time_point completed;
+        latency_clock::time_point started;
+        latency_clock::time_point resumed;
+        auto operation = pending(signal.get(), completed);
+        auto awaiter = await_timed(operation, started, resumed);
+        SetEvent(signal.get());
+        awaiter.get();
+        return resumed - completed;
+    });
+}
+
+TEST_CASE("latency, resume_background", "[.][latency]")
+{
+    std::vector<double> samples;
+    samples.reserve(sample_count);
+    hops(sample_count / 10, samples).get();
+    samples.clear();
+    hops(sample_count, samples).get();
+    report_latency("resume_background hop", std::move(samples));
+
+    handle pong{ check_pointer(CreateEventW(nullptr, false, false, nullptr)) };
+
+    measure_latency("resume_background ping-pong", sample_count, [&]
+    {
+        auto const start = latency_clock::now();
+        ping(pong.get());
+        WaitForSingleObject(pong.get(), INFINITE);
+        return latency_clock::now() - start;
+    });
+}
+
+TEST_CASE("latency, resume_after", "[.][latency]")
+{
+    // Reports how late each timer fires, so the spread of the percentiles is the jitter.
+    for (auto const duration : { 1ms, 10ms })
+    {
+        measure_latency("resume_after " + std::to_string(duration.count()) + "ms lateness", timer_sample_count, [&]
+        {
+            latency_clock::duration lateness{};
+            delayed(duration, lateness).get();
+            return lateness;
+        });
+    }
+}
+
+TEST_CASE("latency, when_all and when_any", "[.][latency]")
+{
+    handle signal{ check_pointer(CreateEventW(nullptr, true, false, nullptr)) };
+    measure_when<1>(signal);
+    measure_when<8>(signal);
+    measure_when<64>(signal);
+}
+
+TEST_CASE("latency, cancellation", "[.][latency]")
+{
+    handle unsignaled{ check_pointer(CreateEventW(nullptr, true, false, nullptr)) };
+
+    measure_latency("Cancel to awaiter resumption", sample_count, [&]
+    {
+        latency_clock::time_point resumed;
+        auto operation = never(unsignaled.get());
+        auto awaiter = await_canceled(operation, resumed);
+        auto const canceled = latency_clock::now();
+        operation.Cancel();
+        awaiter.get();
+        return resumed - canceled;
+    });
+
+    measure_latency("Cancel propagated through a nested co_await", sample_count, [&]
+    {
+        latency_clock::time_point resumed;
+        auto operation = nested_never(unsignaled.get());
+        auto awaiter = await_canceled(operation, resumed);
+        auto const canceled = latency_clock::now();
+        operation.Cancel();
+        awaiter.get();
+        return resumed - canceled;
+    });
+}
+
+TEST_CASE("latency, apartment_context", "[.][latency]")
+{
+    auto controller = DispatcherQueueController::CreateOnDedicatedThread();
+    std::vector<double> mta;
+    std::vector<double> to_sta;
+    std::vector<double> to_mta;
+    switch_apartments(controller.DispatcherQueue(), sample_count / 10, mta, to_sta, to_mta).get();
+    mta.clear();
+    to_sta.clear();
+    to_mta.clear();
+    switch_apartments(controller.DispatcherQueue(), sample_count, mta, to_sta, to_mta).get();
+    controller.ShutdownQueueAsync().get();
+
+    report_latency("apartment_context MTA to MTA", std::move(mta));
+    report_latency("apartment_context MTA to STA", std::move(to_sta));
+    report_latency("apartment_context STA to MTA", std::move(to_mta));
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+// Percentiles of individually timed operations. Unlike the regular benchmarks, these time the path between two points
+// that may be on different threads, such as an async completion and the resumption of its awaiter, so each sample is
+// taken by the scenario itself. Results are collected here so that the json reporter can emit them after the regular
+// benchmarks.
+struct latency_result
+{
+    std::string name;
+    uint32_t samples{};
+    double min{};
+    double p50{};
+    double p90{};
+    double p99{};
+    double p999{};
+    double max{};
+};
+
+using latency_clock = std::chrono::steady_clock;
+
+std::vector<latency_result>& latency_results();
+
+// Sorts the samples, which are in nanoseconds, and reports their percentiles under name.
+void report_latency(std::string const& name, std::vector<double> samples);
+
+// Returns the sample at rank, from 0 for the minimum to 1 for the maximum, of samples that are already sorted. Every
+// report uses this, so that the same rank is always rounded to the same, nearest, sample.
+inline double percentile(std::vector<double> const& sorted, double const rank) noexcept
+{
+    if (sorted.empty())
+    {
+        return 0;
+    }
+
+    return sorted[static_cast<size_t>(rank * (sorted.size() - 1) + 0.5)];
+}
+
+inline double to_nanoseconds(latency_clock::duration const duration) noexcept
+{
+    return std::chrono::duration<double, std::nano>(duration).count();
+}
+
+// Calls sample count times, after a few untimed calls to warm up the thread pool and caches, and reports the
+// durations it returns.
+template <typename Sample>
+void measure_latency(std::string const& name, uint32_t const count, Sample sample)
+{
+    for (uint32_t warmup = 0; warmup < (std::min)(count / 10, 100u); ++warmup)
+    {
+        sample();
+    }
+
+    std::vector<double> samples;
+    samples.reserve(count);
+
+    for (uint32_t index = 0; index < count; ++index)
+    {
+        samples.push_back(to_nanoseconds(sample()));
+    }
+
+    report_latency(name, std::move(samples));
+}
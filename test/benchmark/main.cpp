@@ -0,0 +1,159 @@
+#define CATCH_CONFIG_RUNNER
+#include "catch.hpp"
+#include "winrt/base.h"
+#include "latency.h"
+#include "scaling.h"
+
+using namespace winrt;
+
+namespace
+{
+    // Writes one JSON object per benchmark so that runs of different commits can be compared by name. Times are
+    // nanoseconds per iteration. Select with "-r json", optionally with "-o file.json".
+    struct json_reporter : Catch::StreamingReporterBase<json_reporter>
+    {
+        using StreamingReporterBase::StreamingReporterBase;
+
+        static std::string getDescription()
+        {
+            return "Reports benchmark statistics as JSON";
+        }
+
+        void assertionStarting(Catch::AssertionInfo const&) override
+        {
+        }
+
+        bool assertionEnded(Catch::AssertionStats const&) override
+        {
+            return true;
+        }
+
+        void testRunStarting(Catch::TestRunInfo const& info) override
+        {
+            StreamingReporterBase::testRunStarting(info);
+            stream << "{\n  \"benchmarks\": [";
+        }
+
+        void benchmarkEnded(Catch::BenchmarkStats<> const& stats) override
+        {
+            std::vector<double> samples;
+            samples.reserve(stats.samples.size());
+
+            for (auto&& sample : stats.samples)
+            {
+                samples.push_back(sample.count());
+            }
+
+            std::sort(samples.begin(), samples.end());
+
+            stream << (m_first ? "\n" : ",\n");
+            m_first = false;
+
+            stream << "    { \"name\": \"" << escape(currentTestCaseInfo->name + "/" + stats.info.name) << "\""
+                << ", \"samples\": " << samples.size()
+                << ", \"iterations\": " << stats.info.iterations
+                << ", \"mean\": " << stats.mean.point.count()
+                << ", \"mean_lower\": " << stats.mean.lower_bound.count()
+                << ", \"mean_upper\": " << stats.mean.upper_bound.count()
+                << ", \"std_dev\": " << stats.standardDeviation.point.count()
+                << ", \"min\": " << percentile(samples, 0.0)
+                << ", \"median\": " << percentile(samples, 0.5)
+                << ", \"p90\": " << percentile(samples, 0.9)
+                << ", \"max\": " << percentile(samples, 1.0)
+                << ", \"outliers\": " << stats.outliers.total()
+                << ", \"outlier_variance\": " << stats.outlierVariance
+                << " }";
+        }
+
+        void benchmarkFailed(std::string const& error) override
+        {
+            stream << (m_first ? "\n" : ",\n");
+            m_first = false;
+            stream << "    { \"name\": \"" << escape(currentTestCaseInfo->name) << "\", \"error\": \"" << escape(error) << "\" }";
+        }
+
+        void testRunEnded(Catch::TestRunStats const& stats) override
+        {
+            stream << "\n  ],\n  \"scaling\": [";
+            bool first{ true };
+
+            for (auto&& result : scaling_results())
+            {
+                stream << (first ? "\n" : ",\n");
+                first = false;
+
+                stream << "    { \"name\": \"" << escape(result.name) << "\""
+                    << ", \"threads\": " << result.threads
+                    << ", \"write_percent\": " << result.write_percent
+                    << ", \"ops_per_second\": " << result.ops_per_second
+                    << ", \"p50\": " << result.p50
+                    << ", \"p99\": " << result.p99
+                    << ", \"p999\": " << result.p999
+                    << ", \"max\": " << result.max
+                    << " }";
+            }
+
+            stream << "\n  ],\n  \"latency\": [";
+            first = true;
+
+            for (auto&& result : latency_results())
+            {
+                stream << (first ? "\n" : ",\n");
+                first = false;
+
+                stream << "    { \"name\": \"" << escape(result.name) << "\""
+                    << ", \"samples\": " << result.samples
+                    << ", \"min\": " << result.min
+                    << ", \"p50\": " << result.p50
+                    << ", \"p90\": " << result.p90
+                    << ", \"p99\": " << result.p99
+                    << ", \"p999\": " << result.p999
+                    << ", \"max\": " << result.max
+                    << " }";
+            }
+
+            stream << "\n  ],\n  \"failed\": " << stats.totals.assertions.failed << "\n}\n";
+            StreamingReporterBase::testRunEnded(stats);
+        }
+
+    private:
+
+        static std::string escape(std::string const& value)
+        {
+            std::string result;
+
+            for (char const c : value)
+            {
+                if (c == '\n')
+                {
+                    result += "\\n";
+                    continue;
+                }
+
+                if (c == '"' || c == '\\')
+                {
+                    result += '\\';
+                }
+
+                result += c;
+            }
+
+            return result;
+        }
+
+        bool m_first{ true };
+    };
+}
+
+CATCH_REGISTER_REPORTER("json", json_reporter)
+
+int main(int const argc, char** argv)
+{
+    init_apartment();
+    return Catch::Session().run(argc, argv);
+}
+
+CATCH_TRANSLATE_EXCEPTION(hresult_error const& e)
+{
+    return to_string(e.message());
+}
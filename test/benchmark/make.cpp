@@ -0,0 +1,50 @@
+#include "pch.h"
+
+using namespace winrt;
+using namespace Windows::Foundation;
+
+namespace
+{
+    struct Stringable : implements<Stringable, IStringable>
+    {
+        hstring ToString()
+        {
+            return {};
+        }
+    };
+
+    struct Closable : implements<Closable, IStringable, IClosable>
+    {
+        hstring ToString()
+        {
+            return {};
+        }
+
+        void Close()
+        {
+        }
+    };
+}
+
+TEST_CASE("make")
+{
+    BENCHMARK("one interface")
+    {
+        return make<Stringable>();
+    };
+
+    BENCHMARK("two interfaces")
+    {
+        return make<Closable>();
+    };
+
+    BENCHMARK("make_self")
+    {
+        return make_self<Stringable>();
+    };
+
+    BENCHMARK("delegate")
+    {
+        return EventHandler<int>([](auto&&, int) {});
+    };
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+#define WINRT_LEAN_AND_MEAN
+#include <unknwn.h>
+#include "winrt/Windows.Foundation.h"
+#include "winrt/Windows.Foundation.Collections.h"
+#include <numeric>
+#include "catch.hpp"
+
+using namespace std::literals;
@@ -0,0 +1,112 @@
+#include "pch.h"
+#include "scaling.h"
+
+using namespace winrt;
+using namespace Windows::Foundation;
+using namespace Windows::Foundation::Collections;
+
+// These take several seconds each, so they are hidden and run with "benchmark [scaling]".
+
+std::vector<scaling_result>& scaling_results()
+{
+    static std::vector<scaling_result> results;
+    return results;
+}
+
+void report_scaling(scaling_result const& result)
+{
+    Catch::cout() << result.name << ", " << result.write_percent << "% writes, " << result.threads << " threads: "
+        << static_cast<uint64_t>(result.ops_per_second) << " ops/s, p50 " << result.p50 << "ns, p99 " << result.p99
+        << "ns, p99.9 " << result.p999 << "ns\n";
+
+    scaling_results().push_back(result);
+}
+
+namespace
+{
+    constexpr uint32_t collection_size{ 1000 };
+    constexpr uint32_t write_percents[]{ 0, 10, 50 };
+
+    template <typename Vector>
+    void vector_scaling(std::string const& name, Vector const& values)
+    {
+        for (uint32_t const write_percent : write_percents)
+        {
+            measure_scaling(name, write_percent,
+                [&](uint32_t random) { return values.GetAt(random % collection_size); },
+                [&](uint32_t random) { values.SetAt(random % collection_size, static_cast<int>(random)); });
+        }
+    }
+
+    template <typename Map>
+    void map_scaling(std::string const& name, Map const& values)
+    {
+        for (uint32_t const write_percent : write_percents)
+        {
+            measure_scaling(name, write_percent,
+                [&](uint32_t random) { return values.Lookup(random % collection_size); },
+                [&](uint32_t random) { values.Insert(random % collection_size, static_cast<int>(random)); });
+        }
+    }
+
+    std::vector<int> vector_values()
+    {
+        std::vector<int> values(collection_size);
+        std::iota(values.begin(), values.end(), 0);
+        return values;
+    }
+
+    std::map<int, int> map_values()
+    {
+        std::map<int, int> values;
+
+        for (int key = 0; key < static_cast<int>(collection_size); ++key)
+        {
+            values.emplace(key, key);
+        }
+
+        return values;
+    }
+}
+
+TEST_CASE("scaling, multi_threaded_vector", "[.][scaling]")
+{
+    vector_scaling("multi_threaded_vector", multi_threaded_vector<int>(vector_values()));
+    vector_scaling("multi_threaded_vector<futex_mutex>", multi_threaded_vector<int, std::allocator<int>, futex_mutex>(vector_values()));
+    vector_scaling("multi_threaded_vector<distributed_shared_mutex>", multi_threaded_vector<int, std::allocator<int>, distributed_shared_mutex>(vector_values()));
+}
+
+TEST_CASE("scaling, multi_threaded_map", "[.][scaling]")
+{
+    map_scaling("multi_threaded_map", multi_threaded_map<int, int>(map_values()));
+    map_scaling("multi_threaded_map<futex_mutex>", multi_threaded_map<int, int, std::less<int>, std::allocator<std::pair<int const, int>>, futex_mutex>(map_values()));
+}
+
+TEST_CASE("scaling, multi_threaded_observable", "[.][scaling]")
+{
+    auto vector = multi_threaded_observable_vector<int>(vector_values());
+    vector.VectorChanged([](auto&&, auto&&) {});
+    vector_scaling("multi_threaded_observable_vector", vector);
+
+    auto map = multi_threaded_observable_map<int, int>(map_values());
+    map.MapChanged([](auto&&, auto&&) {});
+    map_scaling("multi_threaded_observable_map", map);
+}
+
+TEST_CASE("scaling, event", "[.][scaling]")
+{
+    event<EventHandler<int>> source;
+    std::atomic<int> total{};
+
+    for (uint32_t handler = 0; handler < 4; ++handler)
+    {
+        source.add([&](auto&&, int value) { total.fetch_add(value, std::memory_order_relaxed); });
+    }
+
+    for (uint32_t const write_percent : write_percents)
+    {
+        measure_scaling("event", write_percent,
+            [&](uint32_t) { source(nullptr, 1); },
+            [&](uint32_t) { source.remove(source.add([](auto&&, int) {})); });
+    }
+}
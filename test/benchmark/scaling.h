@@ -0,0 +1,130 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include "latency.h"
+
+// Throughput and latency of a mixed read/write workload as the number of threads grows. Results are collected here
+// so that the json reporter can emit them after the regular benchmarks.
+struct scaling_result
+{
+    std::string name;
+    uint32_t threads{};
+    uint32_t write_percent{};
+    double ops_per_second{};
+    double p50{};
+    double p99{};
+    double p999{};
+    double max{};
+};
+
+std::vector<scaling_result>& scaling_results();
+
+void report_scaling(scaling_result const& result);
+
+// Runs read and write on 1, 2, 4, ... threads and finally the hardware thread count, each thread choosing a write for
+// write_percent of its operations. Latencies are in nanoseconds, sampled every eighth operation to keep the
+// clock out of the measurement.
+template <typename Read, typename Write>
+void measure_scaling(std::string const& name, uint32_t const write_percent, Read read, Write write)
+{
+    using clock = std::chrono::steady_clock;
+    uint32_t const max_threads = (std::max)(2u, std::thread::hardware_concurrency());
+    auto const duration = std::chrono::milliseconds(100);
+
+    for (uint32_t threads = 1; threads <= max_threads; threads = threads == max_threads ? threads + 1 : (std::min)(threads * 2, max_threads))
+    {
+        std::atomic<uint32_t> ready{};
+        std::atomic<bool> stop{};
+        std::vector<uint64_t> operations(threads);
+        std::vector<std::vector<double>> latencies(threads);
+        std::vector<std::thread> workers;
+
+        for (uint32_t thread = 0; thread < threads; ++thread)
+        {
+            workers.emplace_back([&, thread]
+            {
+                uint32_t random = thread * 2654435761u + 1;
+                uint64_t count{};
+                auto& samples = latencies[thread];
+                samples.reserve(1 << 16);
+
+                ++ready;
+
+                while (ready.load() != threads)
+                {
+                    std::this_thread::yield();
+                }
+
+                while (!stop.load(std::memory_order_relaxed))
+                {
+                    random ^= random << 13;
+                    random ^= random >> 17;
+                    random ^= random << 5;
+                    bool const writing = random % 100 < write_percent;
+                    bool const sampled = count % 8 == 0;
+                    auto const start = sampled ? clock::now() : clock::time_point{};
+
+                    if (writing)
+                    {
+                        write(random);
+                    }
+                    else
+                    {
+                        read(random);
+                    }
+
+                    if (sampled)
+                    {
+                        samples.push_back(std::chrono::duration<double, std::nano>(clock::now() - start).count());
+                    }
+
+                    ++count;
+                }
+
+                operations[thread] = count;
+            });
+        }
+
+        while (ready.load() != threads)
+        {
+            std::this_thread::yield();
+        }
+
+        auto const start = clock::now();
+        std::this_thread::sleep_for(duration);
+        stop = true;
+        double const elapsed = std::chrono::duration<double>(clock::now() - start).count();
+
+        for (auto&& worker : workers)
+        {
+            worker.join();
+        }
+
+        std::vector<double> merged;
+        uint64_t total{};
+
+        for (uint32_t thread = 0; thread < threads; ++thread)
+        {
+            total += operations[thread];
+            merged.insert(merged.end(), latencies[thread].begin(), latencies[thread].end());
+        }
+
+        std::sort(merged.begin(), merged.end());
+
+        scaling_result result;
+        result.name = name;
+        result.threads = threads;
+        result.write_percent = write_percent;
+        result.ops_per_second = total / elapsed;
+        result.p50 = percentile(merged, 0.5);
+        result.p99 = percentile(merged, 0.99);
+        result.p999 = percentile(merged, 0.999);
+        result.max = percentile(merged, 1.0);
+        report_scaling(result);
+    }
+}
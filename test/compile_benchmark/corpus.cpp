@@ -0,0 +1,107 @@
+// Compiled by compile_benchmark rather than by the project, at the scale given by the macros below. Each of
+// CORPUS_TYPES implementation types implements CORPUS_INTERFACES instantiations of IIterable<T>, where every T is a
+// distinct type argument nested at least CORPUS_DEPTH generic levels deep. Making the types instantiates implements<>
+// and its interface lists, while the interface tables and queries evaluate the constexpr SHA-1 of every pinterface
+// GUID and the name_v string of every argument.
+
+#include "winrt/Windows.Foundation.Collections.h"
+
+#ifndef CORPUS_INTERFACES
+#define CORPUS_INTERFACES 5
+#endif
+
+#ifndef CORPUS_DEPTH
+#define CORPUS_DEPTH 1
+#endif
+
+#ifndef CORPUS_TYPES
+#define CORPUS_TYPES 4
+#endif
+
+using namespace winrt;
+using namespace Windows::Foundation;
+using namespace Windows::Foundation::Collections;
+
+namespace
+{
+    using elements = std::tuple<int32_t, uint32_t, int64_t, uint64_t, int16_t, uint16_t, uint8_t, float, double, bool, char16_t, hstring, guid, IInspectable>;
+
+    // Alternates IVectorView<T> and IMapView<hstring, T> so that the signatures grow with each level.
+    template <typename T, size_t Depth>
+    struct nested
+    {
+        using inner = typename nested<T, Depth - 1>::type;
+        using type = std::conditional_t<Depth % 2 == 1, IVectorView<inner>, IMapView<hstring, inner>>;
+    };
+
+    template <typename T>
+    struct nested<T, 0>
+    {
+        using type = T;
+    };
+
+    // Once the elements run out they repeat one level deeper, so every index names a different type.
+    template <size_t Index>
+    using argument = typename nested<std::tuple_element_t<Index % std::tuple_size_v<elements>, elements>,
+        CORPUS_DEPTH + Index / std::tuple_size_v<elements>>::type;
+
+    template <size_t Index>
+    using interface_at = IIterable<argument<Index>>;
+
+    // Every IIterable<T> has a First method, so a single member converts to whichever IIterator<T> the producer asks
+    // for.
+    struct any_iterator
+    {
+        template <typename T>
+        operator IIterator<T>() const noexcept
+        {
+            return nullptr;
+        }
+    };
+
+    template <size_t Type, typename Indexes>
+    struct corpus_type;
+
+    template <size_t Type, size_t... Index>
+    struct corpus_type<Type, std::index_sequence<Index...>> :
+        implements<corpus_type<Type, std::index_sequence<Index...>>, interface_at<Type + Index>...>
+    {
+        any_iterator First() const noexcept
+        {
+            return {};
+        }
+    };
+
+    template <size_t... Type>
+    std::vector<IInspectable> make_types(std::index_sequence<Type...>)
+    {
+        return { make<corpus_type<Type, std::make_index_sequence<CORPUS_INTERFACES>>>()... };
+    }
+
+    template <size_t... Index>
+    size_t query_all(IInspectable const& object, std::index_sequence<Index...>)
+    {
+        return ((object.try_as<interface_at<Index>>() ? 1 : 0) + ... + 0);
+    }
+
+    template <size_t... Index>
+    constexpr size_t name_lengths(std::index_sequence<Index...>) noexcept
+    {
+        return (name_of<interface_at<Index>>().size() + ... + 0);
+    }
+
+    using all_interfaces = std::make_index_sequence<CORPUS_INTERFACES + CORPUS_TYPES - 1>;
+    static_assert(name_lengths(all_interfaces()) > 0);
+}
+
+size_t corpus()
+{
+    size_t result{};
+
+    for (auto&& object : make_types(std::make_index_sequence<CORPUS_TYPES>()))
+    {
+        result += query_all(object, all_interfaces());
+    }
+
+    return result;
+}
@@ -0,0 +1,299 @@
+#include "pch.h"
+
+// Measures the compile time and memory of base.h template machinery by compiling corpus.cpp with clang at increasing
+// scale. Each run uses -ftime-trace, and the "Total" events of the trace, such as Frontend, InstantiateClass and
+// InstantiateFunction, are reported alongside wall time and peak memory. The corpus needs a projection that includes
+// Windows.Foundation.Collections.h, such as the one that build_projection.cmd writes.
+
+namespace
+{
+    struct options
+    {
+        std::vector<uint32_t> interfaces{ 5, 10, 20, 50 };
+        std::vector<uint32_t> depths{ 1, 4 };
+        uint32_t types{ 4 };
+        std::string compiler{ "clang++" };
+        std::string flags;
+        std::filesystem::path corpus{ "test/compile_benchmark/corpus.cpp" };
+        std::vector<std::filesystem::path> includes;
+        std::filesystem::path output{ "compile_benchmark" };
+        std::filesystem::path json;
+    };
+
+    [[noreturn]] void usage()
+    {
+        std::cerr << R"(compile_benchmark [options...]
+
+  -interfaces <n,...>  Interfaces per implementation type (5,10,20,50)
+  -depth <n,...>       Minimum nesting of generic type arguments (1,4)
+  -types <n>           Implementation types per run (4)
+  -compiler <path>     clang++ or clang-cl executable (clang++)
+  -flags <flags>       Additional compiler flags
+  -corpus <path>       Corpus source (test/compile_benchmark/corpus.cpp)
+  -include <path>      Folder containing the winrt projection, may be repeated
+  -output <path>       Working folder (compile_benchmark)
+  -json <path>         Write results as JSON
+)";
+        std::exit(1);
+    }
+
+    std::vector<uint32_t> to_counts(std::string const& value)
+    {
+        std::vector<uint32_t> result;
+        std::istringstream stream{ value };
+
+        for (std::string item; std::getline(stream, item, ',');)
+        {
+            result.push_back(static_cast<uint32_t>(std::stoul(item)));
+        }
+
+        return result;
+    }
+
+    options parse(int const argc, char** argv)
+    {
+        options result;
+
+        for (int index = 1; index < argc; ++index)
+        {
+            std::string_view const name{ argv[index] };
+
+            if (index + 1 == argc)
+            {
+                usage();
+            }
+
+            std::string const value{ argv[++index] };
+
+            if (name == "-interfaces") result.interfaces = to_counts(value);
+            else if (name == "-depth") result.depths = to_counts(value);
+            else if (name == "-types") result.types = static_cast<uint32_t>(std::stoul(value));
+            else if (name == "-compiler") result.compiler = value;
+            else if (name == "-flags") result.flags = value;
+            else if (name == "-corpus") result.corpus = value;
+            else if (name == "-include") result.includes.push_back(value);
+            else if (name == "-output") result.output = value;
+            else if (name == "-json") result.json = value;
+            else
+            {
+                usage();
+            }
+        }
+
+        if (result.includes.empty() || result.interfaces.empty() || result.depths.empty() || !result.types)
+        {
+            usage();
+        }
+
+        return result;
+    }
+
+    struct run_result
+    {
+        uint32_t interfaces{};
+        uint32_t depth{};
+        int exit_code{};
+        double wall{};
+        uint64_t peak{};
+        std::vector<std::pair<std::string, double>> totals;
+    };
+
+    std::string quote(std::filesystem::path const& path)
+    {
+        return "\"" + path.string() + "\"";
+    }
+
+    // Runs the command and returns its exit code, along with the peak memory of the process in KB. The driver runs
+    // cc1 in process by default, so this is the memory of the compilation itself.
+    int run(std::string const& command, uint64_t& peak)
+    {
+        std::cout << "> " << command << "\n";
+        peak = 0;
+
+#ifdef _WIN32
+        STARTUPINFOA startup{ sizeof(startup) };
+        PROCESS_INFORMATION process{};
+        std::string line{ command };
+
+        if (!CreateProcessA(nullptr, line.data(), nullptr, nullptr, false, 0, nullptr, nullptr, &startup, &process))
+        {
+            return -1;
+        }
+
+        WaitForSingleObject(process.hProcess, INFINITE);
+        DWORD exit_code{};
+        GetExitCodeProcess(process.hProcess, &exit_code);
+        PROCESS_MEMORY_COUNTERS memory{ sizeof(memory) };
+
+        if (GetProcessMemoryInfo(process.hProcess, &memory, sizeof(memory)))
+        {
+            peak = memory.PeakWorkingSetSize / 1024;
+        }
+
+        CloseHandle(process.hThread);
+        CloseHandle(process.hProcess);
+        return static_cast<int>(exit_code);
+#else
+        std::cout.flush();
+        pid_t const child = fork();
+
+        if (child == 0)
+        {
+            execl("/bin/sh", "sh", "-c", command.c_str(), static_cast<char*>(nullptr));
+            _exit(127);
+        }
+
+        int status{};
+        rusage usage{};
+
+        if (child < 0 || wait4(child, &status, 0, &usage) != child)
+        {
+            return -1;
+        }
+
+        peak = static_cast<uint64_t>(usage.ru_maxrss);
+        return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+#endif
+    }
+
+    // Collects the "Total <name>" summary events that -ftime-trace appends to the trace, in milliseconds.
+    std::vector<std::pair<std::string, double>> parse_trace(std::filesystem::path const& path)
+    {
+        std::ifstream file{ path, std::ios::binary };
+        std::string const trace{ std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+        std::string_view const marker{ "\"name\":\"Total " };
+        std::vector<std::pair<std::string, double>> result;
+
+        for (auto position = trace.find(marker); position != std::string::npos; position = trace.find(marker, position + 1))
+        {
+            auto const name_start = position + marker.size();
+            auto const name_end = trace.find('"', name_start);
+            auto const object = trace.rfind('{', position);
+            auto const duration = trace.find("\"dur\":", object);
+
+            if (name_end == std::string::npos || object == std::string::npos || duration == std::string::npos || duration > position)
+            {
+                continue;
+            }
+
+            double const microseconds = std::stod(trace.substr(duration + 6, 32));
+            result.emplace_back(trace.substr(name_start, name_end - name_start), microseconds / 1000.0);
+        }
+
+        std::sort(result.begin(), result.end(), [](auto&& left, auto&& right)
+        {
+            return left.second > right.second;
+        });
+
+        return result;
+    }
+
+    // clang-cl takes MSVC style options for everything except -ftime-trace, which both drivers accept.
+    std::string compile_command(options const& options, uint32_t const interfaces, uint32_t const depth, std::filesystem::path const& object)
+    {
+        bool const cl = std::filesystem::path(options.compiler).stem().string().find("clang-cl") != std::string::npos;
+        std::string command = options.compiler;
+
+        if (cl)
+        {
+            command += " /nologo /std:c++17 /EHsc /c /Fo" + quote(object);
+        }
+        else
+        {
+            command += " -std=c++17 -c -o " + quote(object);
+        }
+
+        command += " -ftime-trace";
+        command += " -DCORPUS_INTERFACES=" + std::to_string(interfaces);
+        command += " -DCORPUS_DEPTH=" + std::to_string(depth);
+        command += " -DCORPUS_TYPES=" + std::to_string(options.types);
+
+        for (auto&& include : options.includes)
+        {
+            command += " -I" + quote(include);
+        }
+
+        if (!options.flags.empty())
+        {
+            command += " " + options.flags;
+        }
+
+        return command + " " + quote(options.corpus);
+    }
+
+    void write_json(options const& options, std::vector<run_result> const& results)
+    {
+        std::ofstream json{ options.json };
+        json << "{\n  \"types\": " << options.types << ",\n  \"runs\": [";
+
+        for (size_t index = 0; index < results.size(); ++index)
+        {
+            auto&& result = results[index];
+            json << (index ? ",\n" : "\n") << "    { \"interfaces\": " << result.interfaces
+                << ", \"depth\": " << result.depth
+                << ", \"exit_code\": " << result.exit_code
+                << ", \"wall_ms\": " << result.wall
+                << ", \"peak_kb\": " << result.peak
+                << ", \"totals\": {";
+
+            for (size_t total = 0; total < result.totals.size(); ++total)
+            {
+                json << (total ? ", " : " ") << "\"" << result.totals[total].first << "\": " << result.totals[total].second;
+            }
+
+            json << " } }";
+        }
+
+        json << "\n  ]\n}\n";
+    }
+}
+
+int main(int const argc, char** argv)
+{
+    auto const options = parse(argc, argv);
+    std::filesystem::create_directories(options.output);
+    std::vector<run_result> results;
+
+    for (uint32_t const depth : options.depths)
+    {
+        for (uint32_t const interfaces : options.interfaces)
+        {
+            auto const name = "corpus_" + std::to_string(interfaces) + "_" + std::to_string(depth);
+            auto const object = options.output / (name + ".obj");
+            auto const trace = options.output / (name + ".json");
+            std::filesystem::remove(trace);
+
+            run_result result;
+            result.interfaces = interfaces;
+            result.depth = depth;
+            auto const start = std::chrono::steady_clock::now();
+            result.exit_code = run(compile_command(options, interfaces, depth, object), result.peak);
+            result.wall = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            result.totals = parse_trace(trace);
+
+            std::cout << interfaces << " interfaces, depth " << depth << ": " << result.wall << "ms, peak " << result.peak << "KB\n";
+
+            for (size_t total = 0; total < result.totals.size() && total < 8; ++total)
+            {
+                std::cout << "  " << result.totals[total].first << " " << result.totals[total].second << "ms\n";
+            }
+
+            results.push_back(std::move(result));
+        }
+    }
+
+    if (!options.json.empty())
+    {
+        write_json(options, results);
+    }
+
+    for (auto&& result : results)
+    {
+        if (result.exit_code != 0)
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
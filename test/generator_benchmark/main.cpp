@@ -0,0 +1,355 @@
+#include "pch.h"
+
+// Measures cppwinrt end to end against synthetic metadata of a configurable size. The metadata is described in MIDL 3
+// and compiled with midlrt, since there is no metadata writer in this repo. Pass -winmd to reuse metadata generated
+// earlier, for example on a machine without the Windows SDK.
+
+namespace
+{
+    struct options
+    {
+        uint32_t namespaces{ 20 };
+        uint32_t classes{ 20 };
+        uint32_t interfaces{ 10 };
+        uint32_t methods{ 8 };
+        uint32_t generics{ 10 };
+        uint32_t depth{ 4 };
+        std::vector<uint32_t> threads{ 0 };
+        std::filesystem::path output{ "generator_benchmark" };
+        std::string cppwinrt{ "cppwinrt" };
+        std::string midlrt{ "midlrt" };
+        std::string metadata;
+        std::string reference{ "local" };
+        std::filesystem::path winmd;
+        std::filesystem::path json;
+    };
+
+    [[noreturn]] void usage()
+    {
+        std::cerr << R"(generator_benchmark [options...]
+
+  -namespaces <n>     Namespaces to generate (20)
+  -classes <n>        Runtime classes per namespace (20)
+  -interfaces <n>     Additional interfaces per namespace (10)
+  -methods <n>        Methods per interface (8)
+  -generics <n>       Generic instantiations per namespace (10)
+  -depth <n>          Length of each namespace's inheritance chain (4)
+  -threads <n,...>    cppwinrt -threads values to run, 0 for unlimited (0)
+  -cppwinrt <path>    cppwinrt executable (cppwinrt)
+  -midlrt <path>      midlrt executable (midlrt)
+  -metadata <path>    Folder with Windows.Foundation.winmd for midlrt
+  -reference <spec>   cppwinrt -reference for Windows metadata (local)
+  -winmd <path>       Use existing synthetic metadata instead of generating it
+  -output <path>      Working folder (generator_benchmark)
+  -json <path>        Write results as JSON
+)";
+        std::exit(1);
+    }
+
+    uint32_t to_count(std::string const& value)
+    {
+        return static_cast<uint32_t>(std::stoul(value));
+    }
+
+    options parse(int const argc, char** argv)
+    {
+        options result;
+
+        for (int index = 1; index < argc; ++index)
+        {
+            std::string_view const name{ argv[index] };
+
+            if (index + 1 == argc)
+            {
+                usage();
+            }
+
+            std::string const value{ argv[++index] };
+
+            if (name == "-namespaces") result.namespaces = to_count(value);
+            else if (name == "-classes") result.classes = to_count(value);
+            else if (name == "-interfaces") result.interfaces = to_count(value);
+            else if (name == "-methods") result.methods = to_count(value);
+            else if (name == "-generics") result.generics = to_count(value);
+            else if (name == "-depth") result.depth = to_count(value);
+            else if (name == "-cppwinrt") result.cppwinrt = value;
+            else if (name == "-midlrt") result.midlrt = value;
+            else if (name == "-metadata") result.metadata = value;
+            else if (name == "-reference") result.reference = value;
+            else if (name == "-winmd") result.winmd = value;
+            else if (name == "-output") result.output = value;
+            else if (name == "-json") result.json = value;
+            else if (name == "-threads")
+            {
+                result.threads.clear();
+                std::istringstream stream{ value };
+
+                for (std::string item; std::getline(stream, item, ',');)
+                {
+                    result.threads.push_back(to_count(item));
+                }
+            }
+            else
+            {
+                usage();
+            }
+        }
+
+        return result;
+    }
+
+    std::string ns_name(uint32_t const ns)
+    {
+        return "Synthetic.N" + std::to_string(ns);
+    }
+
+    // Each namespace has a chain of unsealed classes, a set of interfaces and sealed classes implementing them, and
+    // methods that use generic instantiations and types from the previous namespace so that the projection has
+    // cross-namespace dependencies to resolve.
+    std::string write_idl(options const& options)
+    {
+        std::ostringstream idl;
+
+        for (uint32_t ns = 0; ns < options.namespaces; ++ns)
+        {
+            std::string const previous = ns ? ns_name(ns - 1) + ".Class0" : "Object";
+            idl << "namespace " << ns_name(ns) << "\n{\n";
+            idl << "    delegate void Handler(Object sender, Int32 value);\n\n";
+
+            for (uint32_t level = 0; level < options.depth; ++level)
+            {
+                idl << "    unsealed runtimeclass Base" << level;
+
+                if (level)
+                {
+                    idl << " : Base" << level - 1;
+                }
+
+                idl << "\n    {\n        Base" << level << "();\n        Int32 Level" << level << ";\n    }\n\n";
+            }
+
+            for (uint32_t index = 0; index < options.interfaces; ++index)
+            {
+                idl << "    interface IInterface" << index << "\n    {\n";
+
+                for (uint32_t method = 0; method < options.methods; ++method)
+                {
+                    std::string const name = std::to_string(index) + "_" + std::to_string(method);
+
+                    switch (method % 4)
+                    {
+                    case 0: idl << "        Int32 Method" << name << "(Int32 value, String name);\n"; break;
+                    case 1: idl << "        String Property" << name << ";\n"; break;
+                    case 2: idl << "        " << previous << " Object" << name << "(" << previous << " value);\n"; break;
+                    case 3: idl << "        event Handler Event" << name << ";\n"; break;
+                    }
+                }
+
+                idl << "    }\n\n";
+            }
+
+            for (uint32_t index = 0; index < options.classes; ++index)
+            {
+                idl << "    runtimeclass Class" << index;
+                char const* separator = " : ";
+
+                if (options.depth)
+                {
+                    idl << separator << "Base" << options.depth - 1;
+                    separator = ", ";
+                }
+
+                for (uint32_t face = 0; face < options.interfaces; ++face)
+                {
+                    if ((index + face) % 3 == 0)
+                    {
+                        idl << separator << "IInterface" << face;
+                        separator = ", ";
+                    }
+                }
+
+                idl << "\n    {\n        Class" << index << "();\n        Class" << index << "(String name);\n";
+                idl << "        static Class" << index << " Create(Int32 value);\n";
+                idl << "        Double Value;\n";
+
+                for (uint32_t generic = 0; generic < options.generics && index == 0; ++generic)
+                {
+                    std::string const target = "Class" + std::to_string(generic % options.classes);
+
+                    switch (generic % 4)
+                    {
+                    case 0: idl << "        Windows.Foundation.Collections.IVector<" << target << "> Vector" << generic << ";\n"; break;
+                    case 1: idl << "        Windows.Foundation.Collections.IMap<String, " << target << "> Map" << generic << ";\n"; break;
+                    case 2: idl << "        Windows.Foundation.IAsyncOperation<" << target << "> Async" << generic << "();\n"; break;
+                    case 3: idl << "        Windows.Foundation.TypedEventHandler<" << target << ", Int32> Handler" << generic << ";\n"; break;
+                    }
+                }
+
+                idl << "    }\n\n";
+            }
+
+            idl << "}\n\n";
+        }
+
+        return idl.str();
+    }
+
+    struct run_result
+    {
+        uint32_t threads{};
+        double wall{};
+        int exit_code{};
+        std::vector<std::pair<std::string, uint64_t>> phases;
+        uint64_t files{};
+        uint64_t bytes{};
+        uint64_t peak{};
+    };
+
+    int run(std::string const& command)
+    {
+        std::cout << "> " << command << "\n";
+        return std::system(command.c_str());
+    }
+
+    std::string quote(std::filesystem::path const& path)
+    {
+        return "\"" + path.string() + "\"";
+    }
+
+    // Parses the lines that cppwinrt -verbose writes after generating the projection.
+    void parse_verbose(std::filesystem::path const& log, run_result& result)
+    {
+        std::ifstream file{ log };
+
+        for (std::string line; std::getline(file, line);)
+        {
+            std::istringstream stream{ line };
+            std::string key;
+            stream >> key;
+
+            if (key == "phase:")
+            {
+                std::string name;
+                uint64_t time{};
+                stream >> name >> time;
+                result.phases.emplace_back(name, time);
+            }
+            else if (key == "files:")
+            {
+                stream >> result.files;
+            }
+            else if (key == "bytes:")
+            {
+                stream >> result.bytes;
+            }
+            else if (key == "peak:")
+            {
+                stream >> result.peak;
+            }
+        }
+    }
+
+    void write_json(options const& options, std::vector<run_result> const& results)
+    {
+        std::ofstream json{ options.json };
+        json << "{\n  \"namespaces\": " << options.namespaces
+            << ",\n  \"classes\": " << options.classes
+            << ",\n  \"interfaces\": " << options.interfaces
+            << ",\n  \"methods\": " << options.methods
+            << ",\n  \"generics\": " << options.generics
+            << ",\n  \"depth\": " << options.depth
+            << ",\n  \"runs\": [";
+
+        for (size_t index = 0; index < results.size(); ++index)
+        {
+            auto&& result = results[index];
+            json << (index ? ",\n" : "\n") << "    { \"threads\": " << result.threads
+                << ", \"exit_code\": " << result.exit_code
+                << ", \"wall_ms\": " << result.wall
+                << ", \"files_written\": " << result.files
+                << ", \"bytes_written\": " << result.bytes
+                << ", \"peak_kb\": " << result.peak
+                << ", \"phases\": {";
+
+            for (size_t phase = 0; phase < result.phases.size(); ++phase)
+            {
+                json << (phase ? ", " : " ") << "\"" << result.phases[phase].first << "\": " << result.phases[phase].second;
+            }
+
+            json << " } }";
+        }
+
+        json << "\n  ]\n}\n";
+    }
+}
+
+int main(int const argc, char** argv)
+{
+    auto const options = parse(argc, argv);
+    std::filesystem::create_directories(options.output);
+    auto winmd = options.winmd;
+
+    if (winmd.empty())
+    {
+        auto const idl = options.output / "synthetic.idl";
+        winmd = options.output / "synthetic.winmd";
+        std::ofstream{ idl } << write_idl(options);
+
+        std::string command = options.midlrt + " /nologo /winrt /nomidl /W1 /h nul /winmd " + quote(winmd);
+
+        if (!options.metadata.empty())
+        {
+            command += " /metadata_dir " + quote(options.metadata);
+        }
+
+        if (run(command + " " + quote(idl)) != 0)
+        {
+            std::cerr << "midlrt failed; the IDL is in " << idl << "\n";
+            return 1;
+        }
+    }
+
+    std::vector<run_result> results;
+
+    for (uint32_t const threads : options.threads)
+    {
+        auto const projection = options.output / ("projection_" + std::to_string(threads));
+        auto const log = options.output / ("cppwinrt_" + std::to_string(threads) + ".log");
+        std::filesystem::remove_all(projection);
+
+        run_result result;
+        result.threads = threads;
+        auto const start = std::chrono::steady_clock::now();
+
+        result.exit_code = run(options.cppwinrt + " -in " + quote(winmd) + " -ref " + options.reference + " -out " + quote(projection) +
+            " -verbose -threads " + std::to_string(threads) + " > " + quote(log));
+
+        result.wall = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        parse_verbose(log, result);
+
+        std::cout << "threads " << threads << ": " << result.wall << "ms, " << result.files << " files, " << result.bytes
+            << " bytes, peak " << result.peak << "KB\n";
+
+        for (auto&& [name, time] : result.phases)
+        {
+            std::cout << "  " << name << " " << time << "ms\n";
+        }
+
+        results.push_back(std::move(result));
+    }
+
+    if (!options.json.empty())
+    {
+        write_json(options, results);
+    }
+
+    for (auto&& result : results)
+    {
+        if (result.exit_code != 0)
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,467 @@
+#include "pch.h"
+
+// Generates a projection for a fixed metadata corpus and compares it with a checked-in golden manifest. The manifest
+// records the size, hash, and emitted construct counts of every generated file, so that a change to the code writers
+// that grows the projection is reported per namespace and per construct, and fails once it exceeds the thresholds.
+// A missing golden also fails. Pass -update to create the golden or to accept the current output as the new one.
+
+namespace
+{
+    struct options
+    {
+        std::string cppwinrt{ "cppwinrt" };
+        std::filesystem::path golden;
+        std::filesystem::path output{ "generator_golden" };
+        std::string arguments;
+        double max_growth{ 1.0 };
+        double max_construct_growth{ 0.0 };
+        bool update{};
+        bool strict{};
+    };
+
+    [[noreturn]] void usage()
+    {
+        std::cerr << R"(generator_golden [options...] -- <cppwinrt arguments...>
+
+  -cppwinrt <path>           cppwinrt executable (cppwinrt)
+  -golden <path>             Golden manifest to compare with or update
+  -output <path>             Working folder (generator_golden)
+  -max-growth <percent>      Allowed byte growth per namespace and overall (1.0)
+  -max-construct-growth <%>  Allowed growth of each construct count (0.0)
+  -strict                    Fail on any difference from the golden
+  -update                    Create or replace the golden with the current output
+
+The cppwinrt arguments name the corpus; -output is supplied by the tool.
+)";
+        std::exit(1);
+    }
+
+    options parse(int const argc, char** argv)
+    {
+        options result;
+
+        for (int index = 1; index < argc; ++index)
+        {
+            std::string_view const name{ argv[index] };
+
+            if (name == "--")
+            {
+                while (++index < argc)
+                {
+                    result.arguments += " ";
+                    result.arguments += argv[index];
+                }
+
+                break;
+            }
+
+            if (name == "-update") { result.update = true; continue; }
+            if (name == "-strict") { result.strict = true; continue; }
+
+            if (index + 1 == argc)
+            {
+                usage();
+            }
+
+            std::string const value{ argv[++index] };
+
+            if (name == "-cppwinrt") result.cppwinrt = value;
+            else if (name == "-golden") result.golden = value;
+            else if (name == "-output") result.output = value;
+            else if (name == "-max-growth") result.max_growth = std::stod(value);
+            else if (name == "-max-construct-growth") result.max_construct_growth = std::stod(value);
+            else
+            {
+                usage();
+            }
+        }
+
+        if (result.golden.empty() || result.arguments.empty())
+        {
+            usage();
+        }
+
+        return result;
+    }
+
+    // The constructs are recognized by the text that code_writers.h emits for them, one per line.
+    struct construct
+    {
+        std::string_view name;
+        std::string_view first;
+        std::string_view second{};
+    };
+
+    constexpr construct constructs[]
+    {
+        { "category", "> struct category<" },
+        { "name", "inline constexpr auto", " name_v<" },
+        { "guid", "inline constexpr guid guid_v<" },
+        { "abi", "> struct abi<" },
+        { "consume", "struct consume_" },
+        { "consume_method", "WINRT_IMPL_AUTO(", ") consume_" },
+        { "produce", "struct produce<" },
+        { "produce_method", "int32_t __stdcall ", "noexcept final" },
+        { "projected_type", "struct __declspec(empty_bases) " },
+        { "delegate", "struct ", " : winrt::Windows::Foundation::IUnknown" },
+        { "hash", "struct hash<" },
+    };
+
+    struct file_info
+    {
+        uint64_t bytes{};
+        uint64_t hash{};
+        std::map<std::string, uint64_t> counts;
+    };
+
+    using manifest = std::map<std::string, file_info>;
+
+    uint64_t fnv1a(std::string_view const& value)
+    {
+        uint64_t hash = 0xcbf29ce484222325;
+
+        for (auto c : value)
+        {
+            hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001b3;
+        }
+
+        return hash;
+    }
+
+    // The build version appears in the preamble and version assertion of every file. It is replaced before the
+    // file is measured, so that a version bump alone doesn't change every hash.
+    constexpr std::string_view version_markers[]
+    {
+        "// C++/WinRT v",
+        "It was generated by C++/WinRT v",
+        "winrt::check_version(CPPWINRT_VERSION, \"",
+        "#define CPPWINRT_VERSION \"",
+    };
+
+    std::string normalize(std::string text)
+    {
+        for (auto&& marker : version_markers)
+        {
+            for (auto position = text.find(marker); position != std::string::npos; position = text.find(marker, position))
+            {
+                position += marker.size();
+                auto const end = text.find_first_not_of("0123456789.", position);
+                text.replace(position, end - position, "<version>");
+            }
+        }
+
+        return text;
+    }
+
+    file_info measure(std::string const& text)
+    {
+        file_info result;
+        result.bytes = text.size();
+        result.hash = fnv1a(text);
+        std::istringstream stream{ text };
+
+        for (std::string line; std::getline(stream, line);)
+        {
+            auto const start = line.find_first_not_of(' ');
+
+            if (start != std::string::npos && line.compare(start, 8, "template") == 0)
+            {
+                ++result.counts["template"];
+            }
+
+            for (auto&& item : constructs)
+            {
+                auto const first = line.find(item.first);
+
+                if (first != std::string::npos && (item.second.empty() || line.find(item.second, first + item.first.size()) != std::string::npos))
+                {
+                    ++result.counts[std::string{ item.name }];
+                }
+            }
+        }
+
+        return result;
+    }
+
+    manifest measure_folder(std::filesystem::path const& folder)
+    {
+        manifest result;
+
+        for (auto&& entry : std::filesystem::recursive_directory_iterator(folder))
+        {
+            if (!entry.is_regular_file())
+            {
+                continue;
+            }
+
+            std::ifstream file{ entry.path(), std::ios::binary };
+            std::string const text{ std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+            result[std::filesystem::relative(entry.path(), folder).generic_string()] = measure(normalize(text));
+        }
+
+        return result;
+    }
+
+    // One line per file: path, bytes, hash, then name=count for each construct it contains.
+    void write_manifest(std::filesystem::path const& path, manifest const& files)
+    {
+        std::ofstream stream{ path, std::ios::binary };
+
+        for (auto&& [name, info] : files)
+        {
+            stream << name << " " << info.bytes << " " << std::hex << info.hash << std::dec;
+
+            for (auto&& [construct, count] : info.counts)
+            {
+                stream << " " << construct << "=" << count;
+            }
+
+            stream << "\n";
+        }
+    }
+
+    manifest read_manifest(std::filesystem::path const& path)
+    {
+        manifest result;
+        std::ifstream stream{ path };
+
+        for (std::string line; std::getline(stream, line);)
+        {
+            std::istringstream fields{ line };
+            std::string name;
+            file_info info;
+            fields >> name >> info.bytes >> std::hex >> info.hash >> std::dec;
+
+            for (std::string count; fields >> count;)
+            {
+                auto const separator = count.find('=');
+                info.counts[count.substr(0, separator)] = std::stoull(count.substr(separator + 1));
+            }
+
+            result[name] = std::move(info);
+        }
+
+        return result;
+    }
+
+    // Files are grouped by the namespace they project: winrt/A.B.h and winrt/impl/A.B.0.h both belong to A.B.
+    std::string namespace_of(std::string const& file)
+    {
+        auto name = std::filesystem::path(file).filename().string();
+
+        if (name.size() > 2 && name.compare(name.size() - 2, 2, ".h") == 0)
+        {
+            name.resize(name.size() - 2);
+        }
+
+        if (file.compare(0, 11, "winrt/impl/") == 0)
+        {
+            name.resize(name.rfind('.'));
+        }
+
+        return name;
+    }
+
+    struct totals
+    {
+        uint64_t bytes{};
+        std::map<std::string, uint64_t> counts;
+    };
+
+    std::map<std::string, totals> by_namespace(manifest const& files)
+    {
+        std::map<std::string, totals> result;
+
+        for (auto&& [name, info] : files)
+        {
+            auto& total = result[namespace_of(name)];
+            total.bytes += info.bytes;
+
+            for (auto&& [construct, count] : info.counts)
+            {
+                total.counts[construct] += count;
+            }
+        }
+
+        return result;
+    }
+
+    double growth(uint64_t const before, uint64_t const after)
+    {
+        if (before == 0)
+        {
+            return after ? 100.0 : 0.0;
+        }
+
+        return (static_cast<double>(after) - static_cast<double>(before)) * 100.0 / static_cast<double>(before);
+    }
+
+    std::string percent(double const value)
+    {
+        std::ostringstream stream;
+        stream << std::fixed << std::setprecision(2) << value << "%";
+        return stream.str();
+    }
+
+    std::string delta(uint64_t const before, uint64_t const after)
+    {
+        std::ostringstream stream;
+        stream << before << " -> " << after << " (" << std::showpos << static_cast<int64_t>(after) - static_cast<int64_t>(before) << ", " << percent(growth(before, after)) << ")";
+        return stream.str();
+    }
+
+    // Reports every difference and returns the number of threshold violations.
+    uint32_t compare(options const& options, manifest const& golden, manifest const& current)
+    {
+        uint32_t failures{};
+        uint32_t changed{};
+
+        auto fail = [&](std::string const& message)
+        {
+            std::cout << "FAIL  " << message << "\n";
+            ++failures;
+        };
+
+        for (auto&& [name, info] : golden)
+        {
+            if (current.find(name) == current.end())
+            {
+                std::cout << "removed " << name << "\n";
+                ++changed;
+            }
+        }
+
+        for (auto&& [name, info] : current)
+        {
+            auto const found = golden.find(name);
+
+            if (found == golden.end())
+            {
+                std::cout << "added   " << name << " " << info.bytes << " bytes\n";
+                ++changed;
+            }
+            else if (found->second.hash != info.hash)
+            {
+                std::cout << "changed " << name << " " << delta(found->second.bytes, info.bytes) << "\n";
+                ++changed;
+            }
+        }
+
+        auto const before = by_namespace(golden);
+        auto const after = by_namespace(current);
+        totals before_total;
+        totals after_total;
+
+        for (auto&& [ns, total] : after)
+        {
+            auto const found = before.find(ns);
+            uint64_t const previous = found == before.end() ? 0 : found->second.bytes;
+
+            if (previous != total.bytes)
+            {
+                std::cout << "namespace " << ns << " " << delta(previous, total.bytes) << "\n";
+
+                if (growth(previous, total.bytes) > options.max_growth)
+                {
+                    fail("namespace " + ns + " grew by more than " + percent(options.max_growth));
+                }
+            }
+        }
+
+        for (auto&& [ns, total] : before)
+        {
+            before_total.bytes += total.bytes;
+
+            for (auto&& [construct, count] : total.counts)
+            {
+                before_total.counts[construct] += count;
+            }
+        }
+
+        for (auto&& [ns, total] : after)
+        {
+            after_total.bytes += total.bytes;
+
+            for (auto&& [construct, count] : total.counts)
+            {
+                after_total.counts[construct] += count;
+            }
+        }
+
+        std::set<std::string> names;
+
+        for (auto&& [construct, count] : before_total.counts) names.insert(construct);
+        for (auto&& [construct, count] : after_total.counts) names.insert(construct);
+
+        for (auto&& construct : names)
+        {
+            uint64_t const previous = before_total.counts[construct];
+            uint64_t const next = after_total.counts[construct];
+
+            if (previous != next)
+            {
+                std::cout << "construct " << construct << " " << delta(previous, next) << "\n";
+
+                if (growth(previous, next) > options.max_construct_growth)
+                {
+                    fail("construct " + construct + " count grew by more than " + percent(options.max_construct_growth));
+                }
+            }
+        }
+
+        std::cout << "total " << delta(before_total.bytes, after_total.bytes) << ", " << changed << " file(s) differ\n";
+
+        if (growth(before_total.bytes, after_total.bytes) > options.max_growth)
+        {
+            fail("projection grew by more than " + percent(options.max_growth));
+        }
+
+        if (options.strict && changed)
+        {
+            fail("output differs from the golden");
+        }
+
+        return failures;
+    }
+}
+
+int main(int const argc, char** argv)
+{
+    auto const options = parse(argc, argv);
+    auto const projection = options.output / "projection";
+    std::filesystem::remove_all(projection);
+    std::filesystem::create_directories(projection);
+
+    std::string const command = options.cppwinrt + options.arguments + " -output \"" + projection.string() + "\"";
+    std::cout << "> " << command << "\n";
+
+    if (std::system(command.c_str()) != 0)
+    {
+        std::cerr << "cppwinrt failed\n";
+        return 1;
+    }
+
+    auto const current = measure_folder(projection);
+
+    if (options.update)
+    {
+        write_manifest(options.golden, current);
+        std::cout << "Updated " << options.golden.string() << " with " << current.size() << " file(s)\n";
+        return 0;
+    }
+
+    if (!std::filesystem::exists(options.golden))
+    {
+        std::cout << "FAIL  " << options.golden.string() << " not found\n";
+        std::cout << "Run with -update to create it\n";
+        return 1;
+    }
+
+    if (compare(options, read_manifest(options.golden), current))
+    {
+        std::cout << "Run with -update to accept these changes\n";
+        return 1;
+    }
+
+    return 0;
+}
@@ -64,4 +64,9 @@ namespace
     static_assert(std::is_same_v<typename impl::filter<impl::is_interface, IFoo, IFoo2>::first_interface, IFoo>);
     static_assert(std::is_same_v<typename impl::filter<impl::is_interface, IFoo, Bar, IFoo2>::first_interface, IFoo>);
     static_assert(std::is_same_v<typename impl::filter<impl::is_interface, Bar, IFoo, IFoo2>::first_interface, IBar>);
+
+    static_assert(std::is_same_v<impl::filter<impl::is_interface, IFoo, impl::interface_list<IFoo2, composing>, Bar>, impl::interface_list<IFoo, IFoo2, IBar, IBar2>>);
+    static_assert(std::is_same_v<impl::interface_list_if<impl::is_interface, IFoo, Bar, composable, IFoo2>, impl::interface_list<IFoo, IFoo2>>);
+    static_assert(std::is_same_v<impl::pack_element<0, IFoo, Bar, IFoo2>, IFoo>);
+    static_assert(std::is_same_v<impl::pack_element<2, IFoo, Bar, IFoo2>, IFoo2>);
 }
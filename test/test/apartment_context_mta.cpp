@@ -0,0 +1,46 @@
+#include "pch.h"
+
+using namespace winrt;
+using namespace Windows::Foundation;
+
+namespace
+{
+    IAsyncAction ResumeInline()
+    {
+        co_await resume_background();
+        apartment_context context;
+        REQUIRE(context);
+
+        // Resuming on the MTA from another MTA thread does not need to switch threads.
+        co_await resume_background();
+        auto const thread_id = GetCurrentThreadId();
+        co_await context;
+        REQUIRE(GetCurrentThreadId() == thread_id);
+    }
+
+    IAsyncAction ResumeFromSta(apartment_context context)
+    {
+        REQUIRE(impl::is_sta_thread());
+        co_await context;
+        REQUIRE(impl::is_mta_thread());
+    }
+}
+
+TEST_CASE("apartment_context_mta")
+{
+    ResumeInline().get();
+
+    apartment_context context;
+    REQUIRE(context);
+
+    IAsyncAction async;
+
+    std::thread([&]
+    {
+        init_apartment(apartment_type::single_threaded);
+        async = ResumeFromSta(context);
+        uninit_apartment();
+    }).join();
+
+    async.get();
+}
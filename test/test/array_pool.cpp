@@ -0,0 +1,60 @@
+#include "pch.h"
+
+using namespace winrt;
+
+TEST_CASE("array_pool")
+{
+    impl::array_pool pool;
+
+    // Released blocks are handed out again for requests they're known to be big enough for.
+    void* first = pool.allocate(100);
+    REQUIRE(first);
+    pool.deallocate(first, 100);
+    REQUIRE(pool.allocate(100) == first);
+
+    pool.deallocate(first, 100);
+    void* second = pool.allocate(120);
+    REQUIRE(second != first);
+    REQUIRE(pool.allocate(64) == first);
+
+    // A block from the next size class up is always big enough.
+    pool.deallocate(second, 120);
+    REQUIRE(pool.allocate(50) == second);
+
+    // Pooled blocks are ordinary CoTaskMem blocks.
+    CoTaskMemFree(first);
+    CoTaskMemFree(second);
+
+    // Large blocks bypass the pool.
+    void* huge = pool.allocate(1024 * 1024);
+    REQUIRE(huge);
+    pool.deallocate(huge, 1024 * 1024);
+
+    pool.trim();
+}
+
+TEST_CASE("array_pool, reset_with_capacity")
+{
+    com_array<int32_t> array{ 1, 2, 3, 4 };
+    auto const data = array.data();
+
+    // Shrinking reuses the buffer.
+    array.reset_with_capacity(3);
+    REQUIRE(array.data() == data);
+    REQUIRE(array.size() == 3);
+    REQUIRE(array == com_array<int32_t>{ 0, 0, 0 });
+
+    // Growing replaces it.
+    array.reset_with_capacity(8);
+    REQUIRE(array.size() == 8);
+    REQUIRE(std::all_of(array.begin(), array.end(), [](int32_t value) { return value == 0; }));
+
+    array.reset_with_capacity(0);
+    REQUIRE(array.empty());
+    REQUIRE(array.data() == nullptr);
+
+    com_array<hstring> strings{ L"one", L"two" };
+    strings.reset_with_capacity(1);
+    REQUIRE(strings.size() == 1);
+    REQUIRE(strings[0].empty());
+}
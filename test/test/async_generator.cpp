@@ -0,0 +1,108 @@
+#include "pch.h"
+
+using namespace winrt;
+using namespace Windows::Foundation;
+
+namespace
+{
+    async_generator<int, 4> Numbers(int count)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            if (i % 3 == 0)
+            {
+                co_await resume_background();
+            }
+
+            co_yield i;
+        }
+    }
+
+    async_generator<int> Throws()
+    {
+        co_yield 1;
+        throw hresult_invalid_argument();
+    }
+
+    async_generator<int> Forever(handle const& started)
+    {
+        auto cancel = co_await get_cancellation_token();
+        cancel.enable_propagation();
+
+        for (int i = 0;; ++i)
+        {
+            co_yield i;
+            SetEvent(started.get());
+            co_await resume_on_signal(GetCurrentProcess()); // never wakes
+        }
+    }
+
+    IAsyncOperation<int> Sum(async_generator<int, 4> generator)
+    {
+        int sum = 0;
+        int expected = 0;
+
+        while (auto value = co_await generator.next())
+        {
+            REQUIRE(*value == expected++);
+            sum += *value;
+        }
+
+        co_return sum;
+    }
+
+    IAsyncAction Drain(async_generator<int> generator)
+    {
+        while (co_await generator.next())
+        {
+        }
+    }
+
+    IAsyncAction DrainWithPropagation(async_generator<int> generator)
+    {
+        auto cancel = co_await get_cancellation_token();
+        cancel.enable_propagation();
+
+        while (co_await generator.next())
+        {
+        }
+    }
+}
+
+TEST_CASE("async_generator")
+{
+    REQUIRE(Sum(Numbers(100)).get() == 4950);
+
+    int sum = 0;
+    for_each(Numbers(10), [&](int value) { sum += value; }).get();
+    REQUIRE(sum == 45);
+}
+
+TEST_CASE("async_generator, throw")
+{
+    REQUIRE_THROWS_AS(Drain(Throws()).get(), hresult_invalid_argument);
+}
+
+TEST_CASE("async_generator, abandon")
+{
+    // Dropping the generator before it started, or mid-stream, must not leak or hang.
+    {
+        auto generator = Numbers(10);
+    }
+
+    [](async_generator<int, 4> generator) -> IAsyncAction
+    {
+        auto value = co_await generator.next();
+        REQUIRE(*value == 0);
+    }(Numbers(100)).get();
+}
+
+TEST_CASE("async_generator, cancel")
+{
+    handle started{ CreateEvent(nullptr, true, false, nullptr) };
+    auto async = DrainWithPropagation(Forever(started));
+    REQUIRE(WaitForSingleObject(started.get(), 1000) == WAIT_OBJECT_0);
+
+    async.Cancel();
+    REQUIRE_THROWS_AS(async.get(), hresult_canceled);
+}
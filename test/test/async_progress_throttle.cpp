@@ -0,0 +1,127 @@
+#include "pch.h"
+
+using namespace winrt;
+using namespace Windows::Foundation;
+
+namespace
+{
+    //
+    // Checks that throttled progress reports are coalesced and flushed on completion.
+    //
+
+    IAsyncOperationWithProgress<uint64_t, int> Operation(HANDLE event)
+    {
+        co_await resume_on_signal(event);
+        auto progress = co_await get_progress_token();
+        progress.throttle(std::chrono::hours(1));
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            progress(i);
+        }
+
+        co_return progress.dropped();
+    }
+
+    IAsyncActionWithProgress<int> Action(HANDLE event)
+    {
+        co_await resume_on_signal(event);
+        auto progress = co_await get_progress_token();
+
+        for (int i = 0; i < 10; ++i)
+        {
+            progress(i);
+        }
+
+        REQUIRE(progress.dropped() == 0);
+    }
+
+    IAsyncActionWithProgress<int> Failure(HANDLE event)
+    {
+        co_await resume_on_signal(event);
+        auto progress = co_await get_progress_token();
+        progress.throttle(std::chrono::hours(1));
+        progress(1);
+        progress(2);
+        throw hresult_invalid_argument();
+    }
+
+    IAsyncActionWithProgress<int> Held(HANDLE start, HANDLE finish)
+    {
+        co_await resume_on_signal(start);
+        auto progress = co_await get_progress_token();
+        progress.throttle(50ms);
+        progress(1);
+        progress(2);
+        co_await resume_on_signal(finish);
+    }
+}
+
+TEST_CASE("async_progress_throttle")
+{
+    {
+        handle start{ CreateEvent(nullptr, true, false, nullptr) };
+        auto async = Operation(start.get());
+        std::vector<int> reports;
+
+        async.Progress([&](auto&&, int value)
+            {
+                reports.push_back(value);
+            });
+
+        SetEvent(start.get());
+
+        // The first report is delivered, the rest coalesce into the final flush.
+        REQUIRE(async.get() == 998);
+        REQUIRE(reports == std::vector<int>{ 0, 999 });
+    }
+    {
+        handle start{ CreateEvent(nullptr, true, false, nullptr) };
+        auto async = Action(start.get());
+        int reports = 0;
+
+        async.Progress([&](auto&&, int)
+            {
+                ++reports;
+            });
+
+        SetEvent(start.get());
+        async.get();
+        REQUIRE(reports == 10);
+    }
+    {
+        // The pending report is still flushed when the coroutine fails.
+        handle start{ CreateEvent(nullptr, true, false, nullptr) };
+        auto async = Failure(start.get());
+        std::vector<int> reports;
+
+        async.Progress([&](auto&&, int value)
+            {
+                reports.push_back(value);
+            });
+
+        SetEvent(start.get());
+        REQUIRE_THROWS_AS(async.get(), hresult_invalid_argument);
+        REQUIRE(reports == std::vector<int>{ 1, 2 });
+    }
+    {
+        // The pending report is held past the interval until the coroutine completes.
+        handle start{ CreateEvent(nullptr, true, false, nullptr) };
+        handle finish{ CreateEvent(nullptr, true, false, nullptr) };
+        auto async = Held(start.get(), finish.get());
+        std::vector<int> reports;
+
+        async.Progress([&](auto&&, int value)
+            {
+                reports.push_back(value);
+            });
+
+        SetEvent(start.get());
+        std::this_thread::sleep_for(200ms);
+        REQUIRE(reports == std::vector<int>{ 1 });
+
+        SetEvent(finish.get());
+        async.get();
+        REQUIRE(reports == std::vector<int>{ 1, 2 });
+    }
+}
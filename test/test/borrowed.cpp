@@ -0,0 +1,100 @@
+#include "pch.h"
+
+using namespace winrt;
+using namespace Windows::Foundation;
+using namespace Windows::Foundation::Collections;
+
+namespace
+{
+    struct Stringable : implements<Stringable, IStringable>
+    {
+        hstring ToString()
+        {
+            return L"Stringable";
+        }
+    };
+
+    uint32_t references(IUnknown const& object)
+    {
+        auto abi = static_cast<impl::unknown_abi*>(get_abi(object));
+        abi->AddRef();
+        return abi->Release();
+    }
+
+    hstring call(borrowed<IStringable> const& object)
+    {
+        return object->ToString();
+    }
+
+    template <typename T, typename = void>
+    struct can_borrow : std::false_type {};
+
+    template <typename T>
+    struct can_borrow<T, std::void_t<decltype(borrow(std::declval<T const&>()))>> : std::true_type {};
+
+    static_assert(can_borrow<IStringable>::value);
+    static_assert(can_borrow<IInspectable>::value);
+    static_assert(can_borrow<com_ptr<Stringable>>::value);
+    static_assert(can_borrow<std::vector<IStringable>>::value);
+
+    // Pointer-sized types that don't hold an interface pointer don't compile.
+    static_assert(!can_borrow<hstring>::value);
+    static_assert(!can_borrow<handle>::value);
+    static_assert(!can_borrow<void*>::value);
+    static_assert(!can_borrow<size_t>::value);
+    static_assert(!can_borrow<std::vector<hstring>>::value);
+    static_assert(!impl::is_borrowable_v<hstring>);
+}
+
+TEST_CASE("borrowed")
+{
+    IStringable object = make<Stringable>();
+    uint32_t const owned = references(object);
+
+    {
+        borrowed<IStringable> first = object;
+        borrowed<IStringable> second = first;
+        REQUIRE(first.get() == object);
+        REQUIRE(call(second) == L"Stringable");
+
+#ifndef _DEBUG
+        REQUIRE(references(object) == owned);
+#endif
+    }
+
+    REQUIRE(references(object) == owned);
+
+    borrowed<IStringable> empty = nullptr;
+    REQUIRE(!empty);
+
+    com_ptr<Stringable> impl = make_self<Stringable>();
+    borrowed<com_ptr<Stringable>> self = borrow(impl);
+    REQUIRE(self.get().get() == impl.get());
+}
+
+TEST_CASE("borrowed, array_view")
+{
+    std::vector<IStringable> objects{ make<Stringable>(), make<Stringable>(), make<Stringable>() };
+    uint32_t const owned = references(objects[0]);
+
+    std::vector<borrowed<IStringable>> copies;
+
+    for (borrowed<IStringable> object : borrow(objects))
+    {
+        REQUIRE(object->ToString() == L"Stringable");
+        copies.push_back(object);
+    }
+
+#ifndef _DEBUG
+    REQUIRE(references(objects[0]) == owned);
+#endif
+
+    auto vector = single_threaded_vector<IStringable>();
+    vector.ReplaceAll(unborrow(copies));
+    REQUIRE(vector.Size() == 3);
+    REQUIRE(vector.GetAt(2) == objects[2]);
+
+    copies.clear();
+    vector.Clear();
+    REQUIRE(references(objects[0]) == owned);
+}
@@ -0,0 +1,166 @@
+#include "pch.h"
+
+using namespace winrt;
+using namespace Windows::Foundation;
+
+namespace
+{
+    template <typename T>
+    void Verify(T const& value)
+    {
+        IPropertyValue local = impl::make_reference(value).template as<IPropertyValue>();
+        IPropertyValue system = box_value(value).template as<IPropertyValue>();
+
+        REQUIRE(local.Type() == system.Type());
+        REQUIRE(local.IsNumericScalar() == system.IsNumericScalar());
+        REQUIRE(unbox_value<T>(local) == value);
+    }
+
+    template <typename T>
+    void VerifyArray(T const& value)
+    {
+        com_array<T> array{ value, T{} };
+        IPropertyValue local = impl::make_reference_array<T>(array).template as<IPropertyValue>();
+        IPropertyValue system = box_value(array).template as<IPropertyValue>();
+
+        REQUIRE(local.Type() == system.Type());
+        REQUIRE(!local.IsNumericScalar());
+
+        com_array<T> unboxed = unbox_value<com_array<T>>(local);
+        REQUIRE(unboxed.size() == 2);
+        REQUIRE(unboxed[0] == value);
+        REQUIRE(unboxed[1] == T{});
+    }
+
+    template <typename F>
+    hresult conversion_error(F&& convert)
+    {
+        try
+        {
+            convert();
+        }
+        catch (hresult_error const& e)
+        {
+            return e.code();
+        }
+
+        return impl::error_ok;
+    }
+}
+
+TEST_CASE("box_local")
+{
+    Verify<uint8_t>(42);
+    Verify<int16_t>(42);
+    Verify<uint16_t>(42);
+    Verify<int32_t>(42);
+    Verify<uint32_t>(42);
+    Verify<int64_t>(42);
+    Verify<uint64_t>(42);
+    Verify<float>(42);
+    Verify<double>(42);
+    Verify<char16_t>(42);
+    Verify<bool>(true);
+    Verify<hstring>(L"42");
+    Verify<guid>({ 1,2,3, {4,5,6,7,8,9,10,11} });
+    Verify<DateTime>(DateTime{ TimeSpan{ 42 } });
+    Verify<TimeSpan>(TimeSpan{ 42 });
+    Verify<Point>({ 1, 2 });
+    Verify<Size>({ 1, 2 });
+    Verify<Rect>({ 1, 2, 3, 4 });
+
+    VerifyArray<uint8_t>(42);
+    VerifyArray<int32_t>(42);
+    VerifyArray<double>(42);
+    VerifyArray<bool>(true);
+    VerifyArray<hstring>(L"42");
+    VerifyArray<guid>({ 1,2,3, {4,5,6,7,8,9,10,11} });
+    VerifyArray<Rect>({ 1, 2, 3, 4 });
+}
+
+TEST_CASE("box_local, conversions")
+{
+    auto value = impl::make_reference<uint8_t>(200).as<IPropertyValue>();
+    REQUIRE(value.GetUInt8() == 200);
+    REQUIRE(value.GetInt32() == 200);
+    REQUIRE(value.GetDouble() == 200.0);
+    REQUIRE(conversion_error([&] { value.GetString(); }) == impl::error_type_mismatch);
+    REQUIRE(conversion_error([&] { value.GetBoolean(); }) == impl::error_type_mismatch);
+
+    com_array<int32_t> array;
+    impl::make_reference_array<int32_t>({ 1, 2, 3 }).as<IPropertyValue>().GetInt32Array(array);
+    REQUIRE(array.size() == 3);
+    REQUIRE(array[2] == 3);
+    REQUIRE(conversion_error([&] { value.GetInt32Array(array); }) == impl::error_type_mismatch);
+}
+
+TEST_CASE("box_local, range")
+{
+    // Like PropertyValue, numeric conversions fail rather than truncate values that don't fit.
+    auto large = impl::make_reference<int32_t>(300).as<IPropertyValue>();
+    REQUIRE(large.GetInt16() == 300);
+    REQUIRE(large.GetUInt64() == 300);
+    REQUIRE_THROWS_AS(large.GetUInt8(), hresult_out_of_bounds);
+
+    auto negative = impl::make_reference<int64_t>(-1).as<IPropertyValue>();
+    REQUIRE(negative.GetInt16() == -1);
+    REQUIRE(negative.GetSingle() == -1.0f);
+    REQUIRE_THROWS_AS(negative.GetUInt8(), hresult_out_of_bounds);
+    REQUIRE_THROWS_AS(negative.GetUInt32(), hresult_out_of_bounds);
+    REQUIRE_THROWS_AS(negative.GetUInt64(), hresult_out_of_bounds);
+
+    auto maximum = impl::make_reference<uint64_t>(UINT64_MAX).as<IPropertyValue>();
+    REQUIRE(maximum.GetUInt64() == UINT64_MAX);
+    REQUIRE_THROWS_AS(maximum.GetInt64(), hresult_out_of_bounds);
+
+    auto whole = impl::make_reference<double>(65535.0).as<IPropertyValue>();
+    REQUIRE(whole.GetUInt16() == 65535);
+    REQUIRE_THROWS_AS(whole.GetInt16(), hresult_out_of_bounds);
+    REQUIRE_THROWS_AS(impl::make_reference<double>(1.5).as<IPropertyValue>().GetInt32(), hresult_out_of_bounds);
+    REQUIRE_THROWS_AS(impl::make_reference<double>(9223372036854775808.0).as<IPropertyValue>().GetInt64(), hresult_out_of_bounds);
+    REQUIRE_THROWS_AS(impl::make_reference<double>(1e300).as<IPropertyValue>().GetSingle(), hresult_out_of_bounds);
+    REQUIRE(impl::make_reference<double>(0.5).as<IPropertyValue>().GetSingle() == 0.5f);
+}
+
+TEST_CASE("box_local, cache")
+{
+    REQUIRE(get_abi(impl::make_reference(true)) == get_abi(impl::make_reference(true)));
+    REQUIRE(get_abi(impl::make_reference(false)) == get_abi(impl::make_reference(false)));
+    REQUIRE(get_abi(impl::make_reference(true)) != get_abi(impl::make_reference(false)));
+    REQUIRE(get_abi(impl::make_reference<int32_t>(0)) == get_abi(impl::make_reference<int32_t>(0)));
+    REQUIRE(get_abi(impl::make_reference<uint64_t>(15)) == get_abi(impl::make_reference<uint64_t>(15)));
+    REQUIRE(get_abi(impl::make_reference(hstring{})) == get_abi(impl::make_reference(hstring{})));
+
+    // Values outside the cache are boxed afresh.
+    REQUIRE(get_abi(impl::make_reference<int32_t>(16)) != get_abi(impl::make_reference<int32_t>(16)));
+    REQUIRE(get_abi(impl::make_reference<int32_t>(-1)) != get_abi(impl::make_reference<int32_t>(-1)));
+    REQUIRE(get_abi(impl::make_reference(hstring{ L"42" })) != get_abi(impl::make_reference(hstring{ L"42" })));
+
+    REQUIRE(unbox_value<int32_t>(impl::make_reference<int32_t>(7)) == 7);
+    REQUIRE(unbox_value<bool>(impl::make_reference(true)));
+}
+
+TEST_CASE("box_local, unbox")
+{
+    // Local boxes are read directly, cached or not.
+    REQUIRE(unbox_value<int32_t>(impl::make_reference<int32_t>(3)) == 3);
+    REQUIRE(unbox_value<int32_t>(impl::make_reference<int32_t>(300)) == 300);
+    REQUIRE(unbox_value_or<int32_t>(impl::make_reference<int32_t>(300), 0) == 300);
+    REQUIRE(unbox_value_or<hstring>(impl::make_reference(hstring{ L"value" }), L"") == L"value");
+    REQUIRE(unbox_value_or<hstring>(impl::make_reference(hstring{}), L"default").empty());
+    REQUIRE(unbox_value<guid>(impl::make_reference(guid{ 1,2,3, {4,5,6,7,8,9,10,11} })) == guid{ 1,2,3, {4,5,6,7,8,9,10,11} });
+    REQUIRE(unbox_value<com_array<int32_t>>(impl::make_reference_array<int32_t>({ 1, 2, 3 })).size() == 3);
+
+    // Enums may be boxed as themselves or as their underlying type.
+    REQUIRE(unbox_value<AsyncStatus>(box_value(AsyncStatus::Error)) == AsyncStatus::Error);
+    REQUIRE(unbox_value<AsyncStatus>(impl::make_reference<int32_t>(static_cast<int32_t>(AsyncStatus::Canceled))) == AsyncStatus::Canceled);
+    REQUIRE(unbox_value_or<AsyncStatus>(impl::make_reference<int32_t>(static_cast<int32_t>(AsyncStatus::Completed)), AsyncStatus::Started) == AsyncStatus::Completed);
+
+    // A local box of another type falls back to QueryInterface, which fails as before.
+    REQUIRE(unbox_value_or<int64_t>(impl::make_reference<int32_t>(1), 5) == 5);
+    REQUIRE_THROWS_AS(unbox_value<int64_t>(impl::make_reference<int32_t>(1)), hresult_no_interface);
+
+    // Boxes from PropertyValue are unaffected.
+    REQUIRE(unbox_value<int32_t>(PropertyValue::CreateInt32(42)) == 42);
+    REQUIRE(unbox_value_or<hstring>(PropertyValue::CreateString(L"value"), L"") == L"value");
+}
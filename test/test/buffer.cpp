@@ -0,0 +1,51 @@
+#include "pch.h"
+#include "winrt/Windows.Storage.Streams.h"
+
+using namespace winrt;
+using namespace Windows::Storage::Streams;
+
+TEST_CASE("buffer")
+{
+    IBuffer buffer = make_buffer(16);
+    REQUIRE(buffer.Capacity() == 16);
+    REQUIRE(buffer.Length() == 0);
+    REQUIRE(data_span(buffer).size() == 0);
+
+    buffer.Length(4);
+    REQUIRE_THROWS_AS(buffer.Length(17), hresult_invalid_argument);
+
+    // The generated data() accessor and data_span agree on the bytes.
+    auto span = data_span(buffer);
+    REQUIRE(span.size() == 4);
+    REQUIRE(span.data() == buffer.data());
+    span[3] = 42;
+
+    buffer_access access(buffer);
+    REQUIRE(access.data() == span.data());
+    REQUIRE(access.span()[3] == 42);
+    REQUIRE(access.capacity_span().size() == 16);
+
+    // The cached pointer stays valid as the length changes.
+    buffer.Length(8);
+    REQUIRE(access.span().size() == 8);
+
+    // IBufferByteAccess is a tearoff that shares the buffer's identity.
+    com_ptr<impl::IBufferByteAccess> byte_access = buffer.as<impl::IBufferByteAccess>();
+    REQUIRE(byte_access.as<IBuffer>() == buffer);
+}
+
+TEST_CASE("buffer, caller-owned")
+{
+    uint8_t bytes[]{ 1, 2, 3 };
+    IBuffer buffer = make_buffer(bytes);
+    REQUIRE(buffer.Capacity() == 3);
+    REQUIRE(buffer.Length() == 3);
+    REQUIRE(buffer.data() == bytes);
+
+    // The owner keeps the memory alive for as long as the buffer.
+    std::vector<uint8_t> vector{ 4, 5, 6, 7 };
+    array_view<uint8_t> view = vector;
+    buffer = make_buffer(view, std::move(vector));
+    REQUIRE(data_span(buffer).data() == view.data());
+    REQUIRE(data_span(buffer)[3] == 7);
+}
@@ -0,0 +1,66 @@
+#include "pch.h"
+
+using namespace winrt;
+
+TEST_CASE("com_array_builder")
+{
+    com_array_builder<int32_t> builder;
+    REQUIRE(builder.empty());
+
+    for (int32_t i = 0; i < 100; ++i)
+    {
+        builder.push_back(i);
+    }
+
+    REQUIRE(builder.size() == 100);
+    REQUIRE(builder.capacity() >= 100);
+
+    // The finished array owns the builder's buffer rather than a copy of it.
+    auto const data = builder.data();
+    com_array<int32_t> array = builder.finish();
+    REQUIRE(array.data() == data);
+    REQUIRE(array.size() == 100);
+    REQUIRE(array[99] == 99);
+    REQUIRE(builder.empty());
+    REQUIRE(builder.data() == nullptr);
+
+    REQUIRE(com_array_builder<int32_t>{}.finish().size() == 0);
+}
+
+TEST_CASE("com_array_builder, non-trivial")
+{
+    com_array_builder<hstring> builder(2);
+    builder.emplace_back(L"one");
+    builder.push_back(L"two");
+
+    // Appending an element of the builder itself while it grows.
+    builder.push_back(builder[0]);
+
+    com_array<hstring> array = builder.finish();
+    REQUIRE(array.size() == 3);
+    REQUIRE(array[0] == L"one");
+    REQUIRE(array[1] == L"two");
+    REQUIRE(array[2] == L"one");
+}
+
+TEST_CASE("com_array_builder, contiguous")
+{
+    std::vector<int32_t> vector{ 1, 2, 3 };
+    com_array<int32_t> copied(vector);
+    REQUIRE(copied == array_view<int32_t const>(vector));
+
+    std::array<int32_t, 3> fixed{ 4, 5, 6 };
+    com_array<int32_t> from_array(fixed);
+    REQUIRE(from_array.size() == 3);
+    REQUIRE(from_array[2] == 6);
+
+    std::vector<hstring> strings{ L"a", L"b" };
+    com_array<hstring> moved(std::move(strings));
+    REQUIRE(moved.size() == 2);
+    REQUIRE(moved[1] == L"b");
+
+    std::vector<bool> bits{ true, false };
+    com_array<bool> from_bits(bits);
+    REQUIRE(from_bits[0]);
+    REQUIRE(!from_bits[1]);
+}
@@ -0,0 +1,77 @@
+#include "pch.h"
+
+using namespace winrt;
+
+namespace
+{
+    struct custom_exception
+    {
+        hresult code;
+    };
+
+    hresult translate_system_error(std::system_error const& e) noexcept
+    {
+        return impl::hresult_from_win32(static_cast<uint32_t>(e.code().value()));
+    }
+
+    hresult translate_custom(custom_exception const& e) noexcept
+    {
+        return e.code;
+    }
+
+    hresult translate_custom_later(custom_exception const&) noexcept
+    {
+        return E_UNEXPECTED;
+    }
+
+    template <typename F>
+    hresult translate(F&& thrower) noexcept
+    {
+        try
+        {
+            thrower();
+            return S_OK;
+        }
+        catch (...)
+        {
+            return to_hresult();
+        }
+    }
+}
+
+TEST_CASE("exception_translator")
+{
+    // The translator table is process-wide and can only grow, so this test only adds translators for its own types.
+    REQUIRE(add_exception_translator(translate_system_error));
+    REQUIRE(add_exception_translator(translate_custom));
+    REQUIRE(add_exception_translator(translate_custom_later));
+
+    REQUIRE(translate([] { throw std::system_error(ERROR_FILE_NOT_FOUND, std::system_category()); }) == HRESULT_FROM_WIN32(ERROR_FILE_NOT_FOUND));
+    REQUIRE(translate([] { throw custom_exception{ E_ACCESSDENIED }; }) == E_ACCESSDENIED); // The first match wins.
+
+    // hresult_error and the standard exceptions are still translated as before.
+    REQUIRE(translate([] { throw hresult_changed_state(); }) == E_CHANGED_STATE);
+    REQUIRE(translate([] { throw std::out_of_range("range"); }) == E_BOUNDS);
+    REQUIRE(translate([] { throw std::bad_alloc(); }) == E_OUTOFMEMORY);
+
+    try
+    {
+        throw custom_exception{ E_ACCESSDENIED };
+    }
+    catch (...)
+    {
+        REQUIRE(to_message() == impl::message_from_hresult(E_ACCESSDENIED));
+    }
+}
+
+TEST_CASE("exception_translator, lazy message")
+{
+    set_origination_policy(E_INVALIDARG, origination_policy::none);
+    auto const before = get_origination_counters();
+
+    REQUIRE(translate([] { throw std::invalid_argument("argument"); }) == E_INVALIDARG);
+    REQUIRE(get_origination_counters().full == before.full);
+    REQUIRE(get_origination_counters().suppressed == before.suppressed + 1);
+
+    clear_origination_policy_overrides();
+}
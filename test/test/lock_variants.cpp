@@ -0,0 +1,88 @@
+#include "pch.h"
+
+using namespace winrt;
+using namespace Windows::Foundation;
+using namespace Windows::Foundation::Collections;
+
+namespace
+{
+    template <typename Lock>
+    void check_exclusion()
+    {
+        Lock lock;
+
+        REQUIRE(lock.try_lock());
+        REQUIRE(!lock.try_lock_shared());
+        lock.unlock();
+
+        REQUIRE(lock.try_lock_shared());
+        REQUIRE(lock.try_lock_shared());
+        REQUIRE(!lock.try_lock());
+        lock.unlock_shared();
+        lock.unlock_shared();
+
+        uint32_t counter{};
+        uint32_t shadow{};
+        bool torn{};
+        std::vector<std::thread> threads;
+
+        for (uint32_t thread = 0; thread < 8; ++thread)
+        {
+            threads.emplace_back([&, thread]
+            {
+                for (uint32_t i = 0; i < 10'000; ++i)
+                {
+                    if ((i + thread) % 4 == 0)
+                    {
+                        impl::lock_guard const guard(lock);
+                        shadow = ++counter;
+                    }
+                    else
+                    {
+                        impl::shared_lock_guard const guard(lock);
+
+                        if (shadow != counter)
+                        {
+                            torn = true;
+                        }
+                    }
+                }
+            });
+        }
+
+        for (auto&& thread : threads)
+        {
+            thread.join();
+        }
+
+        REQUIRE(counter == 8 * 2'500);
+        REQUIRE(!torn);
+    }
+}
+
+TEST_CASE("lock_variants")
+{
+    check_exclusion<slim_mutex>();
+    check_exclusion<futex_mutex>();
+    check_exclusion<adaptive_mutex>();
+    check_exclusion<distributed_shared_mutex>();
+}
+
+TEST_CASE("lock_variants, policy")
+{
+    IVector<int> vector = multi_threaded_vector<int, std::allocator<int>, adaptive_mutex>({ 1, 2, 3 });
+    vector.Append(4);
+    REQUIRE(vector.Size() == 4);
+
+    IObservableMap<int, int> map = multi_threaded_observable_map<int, int, std::less<int>, std::allocator<std::pair<int const, int>>, distributed_shared_mutex>();
+    map.Insert(1, 2);
+    REQUIRE(map.Lookup(1) == 2);
+
+    winrt::event<EventHandler<int>, futex_mutex> handlers;
+    int sum{};
+    auto token = handlers.add([&](auto&&, int value) { sum += value; });
+    handlers(nullptr, 42);
+    handlers.remove(token);
+    handlers(nullptr, 42);
+    REQUIRE(sum == 42);
+}
@@ -15,3 +15,12 @@ TEST_CASE("memory_buffer")
     REQUIRE(ptr != nullptr);
     REQUIRE(reference.Capacity() == 3);
 }
+
+TEST_CASE("memory_buffer, data_span")
+{
+    MemoryBuffer buffer{ 3 };
+    auto reference = buffer.CreateReference();
+    auto span = data_span(reference);
+    REQUIRE(span.size() == 3);
+    REQUIRE(span.data() == reference.data());
+}
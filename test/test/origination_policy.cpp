@@ -0,0 +1,119 @@
+#include "pch.h"
+
+using namespace winrt;
+
+namespace
+{
+    struct policy_guard
+    {
+        ~policy_guard()
+        {
+            set_origination_policy(origination_policy::full);
+            clear_origination_policy_overrides();
+        }
+    };
+
+    bool has_thread_error_info()
+    {
+        com_ptr<IErrorInfo> info;
+        GetErrorInfo(0, info.put());
+        return info != nullptr;
+    }
+}
+
+TEST_CASE("origination_policy")
+{
+    policy_guard guard;
+    REQUIRE(get_origination_policy(E_INVALIDARG) == origination_policy::full);
+
+    auto before = get_origination_counters();
+    {
+        hresult_invalid_argument e(L"full");
+        REQUIRE(e.try_as<IRestrictedErrorInfo>());
+    }
+    REQUIRE(get_origination_counters().full == before.full + 1);
+
+    // Lazy errors originate only once their message or ABI result is requested.
+    set_origination_policy(origination_policy::lazy);
+    before = get_origination_counters();
+    {
+        hresult_invalid_argument e(L"lazy");
+        REQUIRE(get_origination_counters().deferred == before.deferred + 1);
+        REQUIRE(get_origination_counters().deferred_originated == before.deferred_originated);
+
+        hresult_invalid_argument copy = e;
+        REQUIRE(copy.message() == L"lazy");
+        REQUIRE(get_origination_counters().deferred_originated == before.deferred_originated + 1);
+        REQUIRE(copy.to_abi() == E_INVALIDARG);
+        REQUIRE(has_thread_error_info());
+        REQUIRE(get_origination_counters().deferred_originated == before.deferred_originated + 1);
+    }
+
+    // Suppressed errors keep their message but never publish error info.
+    set_origination_policy(origination_policy::none);
+    before = get_origination_counters();
+    {
+        hresult_invalid_argument e(L"none");
+        REQUIRE(e.message() == L"none");
+        REQUIRE(!e.try_as<IRestrictedErrorInfo>());
+        REQUIRE(e.to_abi() == E_INVALIDARG);
+        REQUIRE(!has_thread_error_info());
+        REQUIRE(hresult_out_of_bounds().message() == impl::message_from_hresult(E_BOUNDS));
+    }
+    REQUIRE(get_origination_counters().suppressed == before.suppressed + 2);
+    REQUIRE(get_origination_counters().full == before.full);
+}
+
+TEST_CASE("origination_policy, overrides")
+{
+    policy_guard guard;
+    REQUIRE(set_origination_policy(E_BOUNDS, origination_policy::none));
+    REQUIRE(get_origination_policy(E_BOUNDS) == origination_policy::none);
+    REQUIRE(get_origination_policy(E_FAIL) == origination_policy::full);
+
+    REQUIRE(set_origination_policy(E_BOUNDS, origination_policy::lazy));
+    REQUIRE(get_origination_policy(E_BOUNDS) == origination_policy::lazy);
+
+    // The override table has a fixed capacity.
+    for (int32_t code = 1; code < static_cast<int32_t>(impl::origination_settings::capacity); ++code)
+    {
+        REQUIRE(set_origination_policy(E_BOUNDS + code, origination_policy::none));
+    }
+
+    REQUIRE(!set_origination_policy(E_FAIL, origination_policy::none));
+    REQUIRE(set_origination_policy(E_BOUNDS, origination_policy::none));
+
+    clear_origination_policy_overrides();
+    REQUIRE(get_origination_policy(E_BOUNDS) == origination_policy::full);
+}
+
+TEST_CASE("origination_policy, concurrent")
+{
+    policy_guard guard;
+    set_origination_policy(origination_policy::lazy);
+    auto const before = get_origination_counters();
+
+    // Every thread that sees the same lazy error gets its error info, yet it is only originated once.
+    hresult_invalid_argument const shared(L"shared");
+    std::vector<std::thread> threads;
+    std::atomic<uint32_t> originated{};
+
+    for (uint32_t index = 0; index < 8; ++index)
+    {
+        threads.emplace_back([&]
+        {
+            if (shared.try_as<IRestrictedErrorInfo>() && shared.message() == L"shared")
+            {
+                ++originated;
+            }
+        });
+    }
+
+    for (auto&& thread : threads)
+    {
+        thread.join();
+    }
+
+    REQUIRE(originated == 8);
+    REQUIRE(get_origination_counters().deferred_originated == before.deferred_originated + 1);
+}
@@ -0,0 +1,79 @@
+#include "pch.h"
+
+using namespace winrt;
+using namespace Windows::Foundation;
+
+namespace
+{
+    IAsyncAction Sleep(timer_wheel& wheel, TimeSpan duration)
+    {
+        co_await wheel.resume_after(duration);
+    }
+
+    IAsyncAction SleepForever(timer_wheel& wheel)
+    {
+        auto cancel = co_await get_cancellation_token();
+        cancel.enable_propagation();
+        co_await wheel.resume_after(std::chrono::hours(1)); // effectively sleep forever
+        REQUIRE(false);
+    }
+}
+
+TEST_CASE("timer_wheel")
+{
+    timer_wheel wheel;
+
+    auto const start = std::chrono::steady_clock::now();
+    Sleep(wheel, 50ms).get();
+    REQUIRE(std::chrono::steady_clock::now() - start >= 50ms);
+
+    std::vector<IAsyncAction> actions;
+
+    for (uint32_t i = 0; i < 1000; ++i)
+    {
+        actions.push_back(Sleep(wheel, std::chrono::milliseconds(i % 300)));
+    }
+
+    for (auto&& action : actions)
+    {
+        action.get();
+    }
+
+    auto metrics = wheel.metrics();
+    REQUIRE(metrics.pending == 0);
+    REQUIRE(metrics.fired == metrics.scheduled);
+    REQUIRE(metrics.total_lag >= metrics.max_lag);
+}
+
+TEST_CASE("timer_wheel, cancel")
+{
+    timer_wheel wheel;
+
+    auto action = SleepForever(wheel);
+    action.Cancel();
+    REQUIRE_THROWS_AS(action.get(), hresult_canceled);
+
+    auto metrics = wheel.metrics();
+    REQUIRE(metrics.pending == 0);
+    REQUIRE(metrics.fired == 0);
+    REQUIRE(metrics.canceled == metrics.scheduled);
+}
+
+TEST_CASE("timer_wheel, idle")
+{
+    // A fine resolution turns a short idle period into many ticks, which the wheel skips rather than walks.
+    timer_wheel wheel{ std::chrono::microseconds(1) };
+    Sleep(wheel, 1ms).get();
+    std::this_thread::sleep_for(100ms);
+
+    auto const start = std::chrono::steady_clock::now();
+    auto sleeper = Sleep(wheel, 500ms);
+    Sleep(wheel, 10ms).get();
+    REQUIRE(std::chrono::steady_clock::now() - start < 500ms);
+    sleeper.get();
+    REQUIRE(std::chrono::steady_clock::now() - start >= 500ms);
+
+    auto metrics = wheel.metrics();
+    REQUIRE(metrics.pending == 0);
+    REQUIRE(metrics.fired == 3);
+}
@@ -0,0 +1,102 @@
+#include "pch.h"
+
+using namespace winrt;
+using namespace Windows::Foundation;
+
+namespace
+{
+    IAsyncOperation<bool> Wait(wait_multiplexer& multiplexer, HANDLE event, TimeSpan timeout = {})
+    {
+        co_return co_await multiplexer.resume_on_signal(event, timeout);
+    }
+
+    IAsyncAction WaitForever(wait_multiplexer& multiplexer, HANDLE event)
+    {
+        auto cancel = co_await get_cancellation_token();
+        cancel.enable_propagation();
+        co_await multiplexer.resume_on_signal(event);
+        REQUIRE(false);
+    }
+
+    TimeSpan process_time()
+    {
+        FILETIME creation, exit, kernel, user;
+        REQUIRE(GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user));
+
+        auto const ticks = [](FILETIME const& time)
+        {
+            return static_cast<int64_t>((uint64_t{ time.dwHighDateTime } << 32) | time.dwLowDateTime);
+        };
+
+        return TimeSpan{ ticks(kernel) + ticks(user) };
+    }
+}
+
+TEST_CASE("wait_multiplexer")
+{
+    wait_multiplexer multiplexer;
+
+    // More handles than a single WaitForMultipleObjects call can watch.
+    std::vector<handle> events;
+    std::vector<IAsyncOperation<bool>> operations;
+
+    for (uint32_t i = 0; i < 200; ++i)
+    {
+        events.emplace_back(check_pointer(CreateEvent(nullptr, false, false, nullptr)));
+        operations.push_back(Wait(multiplexer, events.back().get()));
+    }
+
+    for (auto&& event : events)
+    {
+        REQUIRE(SetEvent(event.get()));
+    }
+
+    for (auto&& operation : operations)
+    {
+        REQUIRE(operation.get());
+    }
+
+    // Already signaled, so it completes without being registered.
+    handle signaled{ check_pointer(CreateEvent(nullptr, true, true, nullptr)) };
+    REQUIRE(Wait(multiplexer, signaled.get()).get());
+}
+
+TEST_CASE("wait_multiplexer, timeout")
+{
+    wait_multiplexer multiplexer;
+    handle event{ check_pointer(CreateEvent(nullptr, true, false, nullptr)) };
+
+    auto const start = std::chrono::steady_clock::now();
+    REQUIRE(!Wait(multiplexer, event.get(), 50ms).get());
+    REQUIRE(std::chrono::steady_clock::now() - start >= 50ms);
+}
+
+TEST_CASE("wait_multiplexer, cancel")
+{
+    wait_multiplexer multiplexer;
+    handle event{ check_pointer(CreateEvent(nullptr, true, false, nullptr)) };
+
+    auto action = WaitForever(multiplexer, event.get());
+    action.Cancel();
+    REQUIRE_THROWS_AS(action.get(), hresult_canceled);
+}
+
+TEST_CASE("wait_multiplexer, same handle")
+{
+    wait_multiplexer multiplexer;
+    handle event{ check_pointer(CreateEvent(nullptr, true, false, nullptr)) };
+
+    auto first = Wait(multiplexer, event.get());
+    auto second = Wait(multiplexer, event.get());
+
+    // Two waiters on one unsignaled handle must block rather than spin the wait threads.
+    auto const before = process_time();
+    std::this_thread::sleep_for(200ms);
+    REQUIRE(process_time() - before < 100ms);
+    REQUIRE(first.Status() == AsyncStatus::Started);
+    REQUIRE(second.Status() == AsyncStatus::Started);
+
+    REQUIRE(SetEvent(event.get()));
+    REQUIRE(first.get());
+    REQUIRE(second.get());
+}
@@ -0,0 +1,124 @@
+#include "pch.h"
+#include "allocation_counter.h"
+#include <malloc.h>
+#include <new>
+
+namespace
+{
+    std::atomic<uint64_t> s_new_calls{};
+    std::atomic<uint64_t> s_heap_calls{};
+    std::atomic<uint64_t> s_task_calls{};
+    std::atomic<uint64_t> s_frees{};
+    std::atomic<uint64_t> s_bytes{};
+
+    void* count(std::atomic<uint64_t>& calls, size_t const bytes, void* const result) noexcept
+    {
+        if (result)
+        {
+            calls.fetch_add(1, std::memory_order_relaxed);
+            s_bytes.fetch_add(bytes, std::memory_order_relaxed);
+        }
+
+        return result;
+    }
+
+    void count_free(void* const value) noexcept
+    {
+        if (value)
+        {
+            s_frees.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void* allocate(size_t const size)
+    {
+        if (auto result = count(s_new_calls, size, malloc(size ? size : 1)))
+        {
+            return result;
+        }
+
+        throw std::bad_alloc();
+    }
+
+    void* allocate(size_t const size, std::align_val_t const alignment)
+    {
+        if (auto result = count(s_new_calls, size, _aligned_malloc(size ? size : 1, static_cast<size_t>(alignment))))
+        {
+            return result;
+        }
+
+        throw std::bad_alloc();
+    }
+
+    void deallocate(void* const value) noexcept
+    {
+        count_free(value);
+        free(value);
+    }
+
+    void deallocate(void* const value, std::align_val_t) noexcept
+    {
+        count_free(value);
+        _aligned_free(value);
+    }
+}
+
+allocation_counts get_allocation_counts() noexcept
+{
+    return { s_new_calls.load(std::memory_order_relaxed), s_heap_calls.load(std::memory_order_relaxed), s_task_calls.load(std::memory_order_relaxed),
+        s_frees.load(std::memory_order_relaxed), s_bytes.load(std::memory_order_relaxed) };
+}
+
+void* operator new(size_t size) { return allocate(size); }
+void* operator new[](size_t size) { return allocate(size); }
+void* operator new(size_t size, std::align_val_t alignment) { return allocate(size, alignment); }
+void* operator new[](size_t size, std::align_val_t alignment) { return allocate(size, alignment); }
+
+void* operator new(size_t size, std::nothrow_t const&) noexcept
+{
+    return count(s_new_calls, size, malloc(size ? size : 1));
+}
+
+void* operator new[](size_t size, std::nothrow_t const&) noexcept
+{
+    return count(s_new_calls, size, malloc(size ? size : 1));
+}
+
+void operator delete(void* value) noexcept { deallocate(value); }
+void operator delete[](void* value) noexcept { deallocate(value); }
+void operator delete(void* value, size_t) noexcept { deallocate(value); }
+void operator delete[](void* value, size_t) noexcept { deallocate(value); }
+void operator delete(void* value, std::nothrow_t const&) noexcept { deallocate(value); }
+void operator delete[](void* value, std::nothrow_t const&) noexcept { deallocate(value); }
+void operator delete(void* value, std::align_val_t alignment) noexcept { deallocate(value, alignment); }
+void operator delete[](void* value, std::align_val_t alignment) noexcept { deallocate(value, alignment); }
+void operator delete(void* value, size_t, std::align_val_t alignment) noexcept { deallocate(value, alignment); }
+void operator delete[](void* value, size_t, std::align_val_t alignment) noexcept { deallocate(value, alignment); }
+
+// base.h binds these hooks to the Windows functions of the same name with /alternatename, which the linker only
+// applies when the program doesn't define them itself.
+
+extern "C"
+{
+    void* __stdcall WINRT_IMPL_HeapAlloc(void* heap, uint32_t flags, size_t bytes) noexcept
+    {
+        return count(s_heap_calls, bytes, HeapAlloc(heap, flags, bytes));
+    }
+
+    int32_t __stdcall WINRT_IMPL_HeapFree(void* heap, uint32_t flags, void* value) noexcept
+    {
+        count_free(value);
+        return HeapFree(heap, flags, value);
+    }
+
+    void* __stdcall WINRT_IMPL_CoTaskMemAlloc(std::size_t size) noexcept
+    {
+        return count(s_task_calls, size, CoTaskMemAlloc(size));
+    }
+
+    void __stdcall WINRT_IMPL_CoTaskMemFree(void* ptr) noexcept
+    {
+        count_free(ptr);
+        CoTaskMemFree(ptr);
+    }
+}
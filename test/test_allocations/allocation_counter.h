@@ -0,0 +1,36 @@
+#pragma once
+
+// Counts the heap allocations made by the process. allocation_counter.cpp replaces the global operator new and
+// defines the WINRT_IMPL_HeapAlloc and WINRT_IMPL_CoTaskMemAlloc hooks that base.h uses for hstring and com_array,
+// so every allocation made on behalf of C++/WinRT is seen here. The counts are process-wide, so that work completed
+// on the thread pool is included, and an allocation_scope reports the difference since it was constructed.
+
+struct allocation_counts
+{
+    uint64_t new_calls{};   // operator new
+    uint64_t heap_calls{};  // WINRT_IMPL_HeapAlloc, used by hstring
+    uint64_t task_calls{};  // WINRT_IMPL_CoTaskMemAlloc, used by com_array
+    uint64_t frees{};       // Matching operator delete, HeapFree, and CoTaskMemFree calls
+    uint64_t bytes{};       // Bytes requested by all of the allocations
+
+    uint64_t allocations() const noexcept
+    {
+        return new_calls + heap_calls + task_calls;
+    }
+};
+
+allocation_counts get_allocation_counts() noexcept;
+
+struct allocation_scope
+{
+    allocation_counts get() const noexcept
+    {
+        auto const now = get_allocation_counts();
+        return { now.new_calls - m_start.new_calls, now.heap_calls - m_start.heap_calls, now.task_calls - m_start.task_calls,
+            now.frees - m_start.frees, now.bytes - m_start.bytes };
+    }
+
+private:
+
+    allocation_counts m_start{ get_allocation_counts() };
+};
@@ -0,0 +1,149 @@
+#include "pch.h"
+#include "allocation_counter.h"
+
+using namespace winrt;
+using namespace Windows::Foundation;
+
+// These tests pin the number of allocations made by common operations, so that a change adding one fails here.
+// Update the expected counts only when the extra allocation is intended.
+
+namespace
+{
+    struct Stringable : implements<Stringable, IStringable>
+    {
+        hstring ToString()
+        {
+            return {};
+        }
+    };
+
+    IAsyncAction Completed()
+    {
+        co_return;
+    }
+
+    IAsyncAction Background()
+    {
+        co_await resume_background();
+    }
+}
+
+TEST_CASE("allocations_make")
+{
+    allocation_scope scope;
+    {
+        IStringable object = make<Stringable>();
+        object.ToString();
+    }
+    auto const counts = scope.get();
+    REQUIRE(counts.new_calls == 1);
+    REQUIRE(counts.allocations() == 1);
+    REQUIRE(counts.frees == 1);
+}
+
+TEST_CASE("allocations_delegate")
+{
+    allocation_scope scope;
+    {
+        delegate<> local = [] {};
+        local();
+
+        EventHandler<int> handler = [](auto&&, int) {};
+        handler(nullptr, 0);
+    }
+    auto const counts = scope.get();
+    REQUIRE(counts.new_calls == 2);
+    REQUIRE(counts.allocations() == 2);
+    REQUIRE(counts.frees == 2);
+}
+
+TEST_CASE("allocations_event")
+{
+    event<EventHandler<int>> event;
+    EventHandler<int> handler = [](auto&&, int) {};
+
+    // Each change copies the array of delegates; raising the event only takes a reference to it.
+    allocation_scope add_scope;
+    auto const first = event.add(handler);
+    auto const second = event.add(handler);
+    auto const add = add_scope.get();
+
+    allocation_scope raise_scope;
+    event(nullptr, 1);
+    auto const raise = raise_scope.get();
+
+    allocation_scope remove_scope;
+    event.remove(first);
+    event.remove(second);
+    auto const remove = remove_scope.get();
+
+    REQUIRE(add.allocations() == 2);
+    REQUIRE(add.frees == 1);
+    REQUIRE(raise.allocations() == 0);
+    REQUIRE(raise.frees == 0);
+    REQUIRE(remove.allocations() == 1);
+    REQUIRE(remove.frees == 2);
+}
+
+TEST_CASE("allocations_hstring")
+{
+    allocation_scope create_scope;
+    hstring const hello = L"Hello";
+    auto const create = create_scope.get();
+
+    // Copies share the reference-counted buffer.
+    allocation_scope copy_scope;
+    {
+        hstring const other = hello;
+    }
+    auto const copy = copy_scope.get();
+
+    allocation_scope concat_scope;
+    {
+        hstring const text = hello + L" world";
+    }
+    auto const concat = concat_scope.get();
+
+    allocation_scope empty_scope;
+    {
+        hstring const value;
+        hstring const literal = L"";
+    }
+    auto const empty = empty_scope.get();
+
+    REQUIRE(create.heap_calls == 1);
+    REQUIRE(create.allocations() == 1);
+    REQUIRE(copy.allocations() == 0);
+    REQUIRE(concat.heap_calls == 1);
+    REQUIRE(concat.allocations() == 1);
+    REQUIRE(concat.frees == 1);
+    REQUIRE(empty.allocations() == 0);
+}
+
+TEST_CASE("allocations_com_array")
+{
+    allocation_scope scope;
+    {
+        com_array<int32_t> values(10);
+    }
+    auto const counts = scope.get();
+    REQUIRE(counts.task_calls == 1);
+    REQUIRE(counts.allocations() == 1);
+    REQUIRE(counts.frees == 1);
+}
+
+TEST_CASE("allocations_async")
+{
+    // A coroutine that completes synchronously only allocates its frame.
+    allocation_scope completed_scope;
+    Completed().get();
+    auto const completed = completed_scope.get();
+
+    // Waiting for one that completes on the thread pool adds the completion handler.
+    allocation_scope background_scope;
+    Background().get();
+    auto const background = background_scope.get();
+
+    REQUIRE(completed.allocations() == 1);
+    REQUIRE(background.allocations() == 2);
+}
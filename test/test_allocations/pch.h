@@ -0,0 +1,7 @@
+#pragma once
+
+#include <windows.h>
+#include "winrt/Windows.Foundation.h"
+#include "catch.hpp"
+
+using namespace std::literals;
@@ -0,0 +1,46 @@
+#include "pch.h"
+
+using namespace winrt;
+using namespace Windows::Foundation;
+
+#ifndef WINRT_LOCAL_BOXING
+#error This project must be built with WINRT_LOCAL_BOXING
+#endif
+
+TEST_CASE("box_local, box_value")
+{
+    // box_value uses the local implementation, so the cached values are shared rather than created by PropertyValue.
+    REQUIRE(get_abi(box_value(true)) == get_abi(box_value(true)));
+    REQUIRE(get_abi(box_value(0)) == get_abi(box_value(0)));
+    REQUIRE(get_abi(box_value(hstring{})) == get_abi(box_value(hstring{})));
+    REQUIRE(get_abi(box_value(300)) != get_abi(box_value(300)));
+
+    REQUIRE(unbox_value<int32_t>(box_value(300)) == 300);
+    REQUIRE(unbox_value<hstring>(box_value(hstring{ L"value" })) == L"value");
+    REQUIRE(unbox_value_or<int32_t>(box_value(hstring{ L"value" }), 5) == 5);
+    REQUIRE(unbox_value<AsyncStatus>(box_value(AsyncStatus::Error)) == AsyncStatus::Error);
+
+    com_array<int32_t> array{ 1, 2, 3 };
+    REQUIRE(unbox_value<com_array<int32_t>>(box_value(array)).size() == 3);
+}
+
+TEST_CASE("box_local, property_value")
+{
+    auto value = box_value(300).as<IPropertyValue>();
+    REQUIRE(value.Type() == PropertyType::Int32);
+    REQUIRE(value.IsNumericScalar());
+    REQUIRE(value.GetInt16() == 300);
+    REQUIRE(value.GetDouble() == 300.0);
+    REQUIRE_THROWS_AS(value.GetUInt8(), hresult_out_of_bounds);
+    REQUIRE_THROWS_AS(box_value(-1).as<IPropertyValue>().GetUInt32(), hresult_out_of_bounds);
+
+    try
+    {
+        value.GetString();
+        FAIL();
+    }
+    catch (hresult_error const& e)
+    {
+        REQUIRE(e.code() == impl::error_type_mismatch);
+    }
+}
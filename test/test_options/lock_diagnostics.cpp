@@ -0,0 +1,48 @@
+#include "pch.h"
+#include "winrt/Windows.Foundation.Collections.h"
+
+using namespace winrt;
+using namespace Windows::Foundation;
+using namespace Windows::Foundation::Collections;
+
+#ifndef WINRT_LOCK_DIAGNOSTICS
+#error This project must be built with WINRT_LOCK_DIAGNOSTICS
+#endif
+
+TEST_CASE("LockDiagnostics")
+{
+    reset_lock_diagnostics();
+
+    auto values = multi_threaded_vector<int>({ 1, 2, 3 });
+    REQUIRE(values.Size() == 3);
+    values.Append(4);
+
+    event<EventHandler<int>> handlers;
+    handlers.add([](auto&&, int) {});
+    handlers(nullptr, 1);
+
+    auto info = get_lock_diagnostics();
+
+    REQUIRE(info[name_of<IVector<int>>()].acquisitions >= 2);
+    REQUIRE(info[name_of<IVector<int>>()].contentions == 0);
+    REQUIRE(info[name_of<EventHandler<int>>()].acquisitions >= 1);
+
+    slim_mutex lock;
+    lock.diagnostics_name(L"LockDiagnostics");
+    lock.lock();
+
+    std::thread waiter([&]
+    {
+        slim_lock_guard const guard(lock);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    lock.unlock();
+    waiter.join();
+
+    info = get_lock_diagnostics();
+    REQUIRE(info[L"LockDiagnostics"].acquisitions == 2);
+    REQUIRE(info[L"LockDiagnostics"].contentions == 1);
+    REQUIRE(info[L"LockDiagnostics"].wait_time > 0);
+    REQUIRE(dump_lock_diagnostics().find(L"LockDiagnostics") != std::wstring::npos);
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+// The opt-in macros that this project tests change the definitions of inline functions and templates. They are
+// defined for the whole project in test_options.vcxproj rather than here, so that every translation unit, main.cpp
+// included, sees the same definitions.
+
+#include <windows.h>
+#include "winrt/Windows.Foundation.h"
+#include "catch.hpp"
+
+using namespace std::literals;
@@ -0,0 +1,123 @@
+#include "pch.h"
+
+using namespace winrt;
+using namespace Windows::Foundation;
+
+#ifndef WINRT_POOLED_ARRAYS
+#error This project must be built with WINRT_POOLED_ARRAYS
+#endif
+
+namespace
+{
+    struct Stringable : implements<Stringable, IStringable, IClosable>
+    {
+        hstring ToString()
+        {
+            return L"Stringable";
+        }
+
+        void Close()
+        {
+        }
+    };
+}
+
+TEST_CASE("pooled_arrays, com_array")
+{
+    void* data{};
+
+    {
+        com_array<int32_t> array(100);
+        data = array.data();
+    }
+
+    // The released block is handed out again rather than going back to the COM heap.
+    com_array<int32_t> array(90);
+    REQUIRE(array.data() == data);
+    REQUIRE(std::all_of(array.begin(), array.end(), [](int32_t value) { return value == 0; }));
+
+    // Arrays from the pool remain ordinary CoTaskMem blocks that any owner may free.
+    int32_t* abi{};
+    uint32_t size{};
+    std::tie(size, abi) = detach_abi(array);
+    REQUIRE(size == 90);
+    REQUIRE(abi == data);
+    CoTaskMemFree(abi);
+}
+
+TEST_CASE("pooled_arrays, reset_with_capacity")
+{
+    com_array<hstring> strings{ L"one", L"two", L"three", L"four" };
+    auto const data = strings.data();
+
+    strings.reset_with_capacity(3);
+    REQUIRE(strings.data() == data);
+    REQUIRE(strings.size() == 3);
+    REQUIRE(std::all_of(strings.begin(), strings.end(), [](hstring const& value) { return value.empty(); }));
+
+    // The buffer keeps its full size, so growing back within it doesn't reallocate.
+    strings.reset_with_capacity(1);
+    REQUIRE(strings.size() == 1);
+    strings.reset_with_capacity(4);
+    REQUIRE(strings.data() == data);
+    REQUIRE(strings.size() == 4);
+    REQUIRE(std::all_of(strings.begin(), strings.end(), [](hstring const& value) { return value.empty(); }));
+
+    // Growing beyond it releases the whole buffer to the pool, from which the next array of that size is served.
+    strings.reset_with_capacity(1);
+    strings.reset_with_capacity(64);
+    REQUIRE(strings.size() == 64);
+    com_array<hstring> other(4);
+    REQUIRE(other.data() == data);
+}
+
+TEST_CASE("pooled_arrays, com_array_builder")
+{
+    void* data{};
+
+    {
+        com_array_builder<int32_t> builder;
+
+        for (int32_t value = 0; value < 20; ++value)
+        {
+            builder.push_back(value);
+        }
+
+        // The builder's buffer, spare capacity and all, is handed over and later released by the com_array.
+        auto array = builder.finish();
+        REQUIRE(array.size() == 20);
+        REQUIRE(array[19] == 19);
+        data = array.data();
+    }
+
+    com_array_builder<int32_t> builder(20);
+    builder.push_back(1);
+    REQUIRE(builder.finish().data() == data);
+}
+
+TEST_CASE("pooled_arrays, GetIids")
+{
+    IStringable object = make<Stringable>();
+    auto iids = get_interfaces(object);
+    REQUIRE(iids.size() == 2);
+    REQUIRE(std::find(iids.begin(), iids.end(), guid_of<IStringable>()) != iids.end());
+    REQUIRE(std::find(iids.begin(), iids.end(), guid_of<IClosable>()) != iids.end());
+
+    auto const data = iids.data();
+    iids.clear();
+    REQUIRE(get_interfaces(object).data() == data);
+}
+
+TEST_CASE("pooled_arrays, drain")
+{
+    impl::array_pool pool;
+    void* block = pool.allocate(100);
+    pool.deallocate(block, 100);
+
+    // Draining frees the pooled blocks, and from then on released blocks are freed rather than pooled.
+    pool.drain();
+    block = pool.allocate(100);
+    REQUIRE(block);
+    pool.deallocate(block, 100);
+    pool.trim();
+}
@@ -0,0 +1,56 @@
+#include "pch.h"
+
+using namespace winrt;
+using namespace Windows::Foundation;
+
+#ifndef WINRT_TIMER_WHEEL
+#error This project must be built with WINRT_TIMER_WHEEL
+#endif
+
+namespace
+{
+    IAsyncAction Sleep(TimeSpan duration)
+    {
+        co_await resume_after(duration);
+    }
+
+    IAsyncAction SleepForever()
+    {
+        auto cancel = co_await get_cancellation_token();
+        cancel.enable_propagation();
+        co_await resume_after(std::chrono::hours(1));
+        REQUIRE(false);
+    }
+}
+
+TEST_CASE("timer_wheel, resume_after")
+{
+    // resume_after is served by the shared wheel, so its metrics account for every call.
+    auto const before = impl::get_timer_wheel().metrics();
+
+    auto const start = std::chrono::steady_clock::now();
+    Sleep(20ms).get();
+    REQUIRE(std::chrono::steady_clock::now() - start >= 20ms);
+
+    std::vector<IAsyncAction> actions;
+
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        actions.push_back(Sleep(std::chrono::milliseconds(i % 30)));
+    }
+
+    for (auto&& action : actions)
+    {
+        action.get();
+    }
+
+    auto action = SleepForever();
+    action.Cancel();
+    REQUIRE_THROWS_AS(action.get(), hresult_canceled);
+
+    auto const after = impl::get_timer_wheel().metrics();
+    REQUIRE(after.pending == 0);
+    REQUIRE(after.fired - before.fired >= 2);
+    REQUIRE(after.canceled - before.canceled == 1);
+    REQUIRE(after.scheduled - before.scheduled == after.fired - before.fired + 1);
+}
@@ -0,0 +1,37 @@
+#include "pch.h"
+
+using namespace winrt;
+using namespace Windows::Foundation;
+
+namespace
+{
+    struct Factory : implements<Factory, IActivationFactory>
+    {
+        IInspectable ActivateInstance()
+        {
+            return make<Factory>();
+        }
+    };
+}
+
+TEST_CASE("portable_activation")
+{
+    REQUIRE_THROWS_AS(get_activation_factory<IActivationFactory>(L"Portable.Factory"), hresult_class_not_registered);
+
+    auto factory = make<Factory>();
+    register_activation_factory(L"Portable.Factory", factory);
+
+    auto found = get_activation_factory<IActivationFactory>(L"Portable.Factory");
+    REQUIRE(found == factory);
+    REQUIRE(found.ActivateInstance<IInspectable>() != nullptr);
+
+    REQUIRE(unregister_activation_factory(L"Portable.Factory"));
+    REQUIRE(!unregister_activation_factory(L"Portable.Factory"));
+    REQUIRE_THROWS_AS(get_activation_factory<IActivationFactory>(L"Portable.Factory"), hresult_class_not_registered);
+
+    weak_ref<IActivationFactory> weak = factory;
+    REQUIRE(weak.get() == factory);
+    factory = nullptr;
+    found = nullptr;
+    REQUIRE(weak.get() == nullptr);
+}
@@ -0,0 +1,31 @@
+#include "pch.h"
+
+using namespace winrt;
+
+TEST_CASE("portable_errors")
+{
+    REQUIRE(hresult_invalid_argument().message() == L"The parameter is incorrect.");
+    REQUIRE(hresult_not_implemented().message() == L"Not implemented");
+
+    // The error info round trips through the thread's error slot.
+    try
+    {
+        throw hresult_error(impl::error_fail, L"custom");
+    }
+    catch (...)
+    {
+        hresult const code = to_hresult();
+        REQUIRE(code == impl::error_fail);
+
+        try
+        {
+            check_hresult(code);
+            FAIL();
+        }
+        catch (hresult_error const& e)
+        {
+            REQUIRE(e.code() == impl::error_fail);
+            REQUIRE(e.message() == L"custom");
+        }
+    }
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+// Only base.h is included so that these tests can also be built against the portable backend off Windows.
+#include "winrt/base.h"
+#include "catch.hpp"
+
+using namespace std::literals;
@@ -0,0 +1,23 @@
+#include "pch.h"
+
+using namespace winrt;
+
+TEST_CASE("portable_strings")
+{
+    hstring const hello = L"hello";
+    REQUIRE(hello + L" world" == L"hello world");
+    REQUIRE(to_hstring(42) == L"42");
+    REQUIRE(to_hstring(guid{ 0x01234567, 0x89ab, 0xcdef, { 1,2,3,4,5,6,7,8 } }) == L"{01234567-89ab-cdef-0102-030405060708}");
+}
+
+TEST_CASE("portable_strings_utf8")
+{
+    // One, two, three, and four byte sequences.
+    std::string const utf8 = "\x61\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80";
+    hstring const value = to_hstring(utf8);
+    REQUIRE(value.size() == (sizeof(wchar_t) == 2 ? 5u : 4u));
+    REQUIRE(to_string(value) == utf8);
+
+    REQUIRE(to_hstring(std::string_view{}).empty());
+    REQUIRE(to_string(hstring{}).empty());
+}
@@ -0,0 +1,63 @@
+#include "pch.h"
+
+using namespace winrt;
+
+TEST_CASE("portable_slim_mutex")
+{
+    slim_mutex m;
+    slim_condition_variable cv;
+    uint32_t counter{};
+    std::vector<std::thread> threads;
+
+    for (uint32_t i = 0; i < 8; ++i)
+    {
+        threads.emplace_back([&]
+            {
+                for (uint32_t j = 0; j < 10000; ++j)
+                {
+                    slim_lock_guard const guard(m);
+                    ++counter;
+                }
+
+                cv.notify_all();
+            });
+    }
+
+    {
+        slim_lock_guard const guard(m);
+        cv.wait(m, [&] { return counter == 80000; });
+    }
+
+    for (auto&& thread : threads)
+    {
+        thread.join();
+    }
+
+    slim_lock_guard const guard(m);
+    REQUIRE(counter == 80000);
+    REQUIRE(!cv.wait_for(m, 10ms, [] { return false; }));
+}
+
+TEST_CASE("portable_slim_mutex_shared")
+{
+    slim_mutex m;
+    REQUIRE(m.try_lock_shared());
+    REQUIRE(m.try_lock_shared());
+    REQUIRE(!m.try_lock());
+    m.unlock_shared();
+    m.unlock_shared();
+    REQUIRE(m.try_lock());
+    REQUIRE(!m.try_lock_shared());
+    m.unlock();
+}
+
+TEST_CASE("portable_event")
+{
+    event<delegate<int>> e;
+    int total{};
+    auto token = e.add([&](int value) { total += value; });
+    e(2);
+    e.remove(token);
+    e(3);
+    REQUIRE(total == 2);
+}
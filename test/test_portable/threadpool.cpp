@@ -0,0 +1,99 @@
+#include "pch.h"
+
+using namespace winrt;
+
+namespace
+{
+    handle make_event(bool manual_reset)
+    {
+        return handle{ check_pointer(WINRT_IMPL_CreateEventW(nullptr, manual_reset, false, nullptr)) };
+    }
+
+    bool wait(handle const& event)
+    {
+        return WINRT_IMPL_WaitForSingleObject(event.get(), 5000) == 0;
+    }
+
+    fire_and_forget background(handle const& done, std::thread::id& id)
+    {
+        co_await resume_background();
+        id = std::this_thread::get_id();
+        WINRT_IMPL_SetEvent(done.get());
+    }
+
+    fire_and_forget after(handle const& done, std::chrono::steady_clock::duration& elapsed)
+    {
+        auto const start = std::chrono::steady_clock::now();
+        co_await resume_after(50ms);
+        elapsed = std::chrono::steady_clock::now() - start;
+        WINRT_IMPL_SetEvent(done.get());
+    }
+
+    fire_and_forget signal(handle const& trigger, handle const& done, bool& result, Windows::Foundation::TimeSpan timeout)
+    {
+        result = co_await resume_on_signal(trigger.get(), timeout);
+        WINRT_IMPL_SetEvent(done.get());
+    }
+
+    fire_and_forget pooled(thread_pool& pool, handle const& done, std::atomic<uint32_t>& count)
+    {
+        co_await pool;
+
+        if (++count == 100)
+        {
+            WINRT_IMPL_SetEvent(done.get());
+        }
+    }
+}
+
+TEST_CASE("portable_resume_background")
+{
+    auto done = make_event(true);
+    std::thread::id id;
+    background(done, id);
+    REQUIRE(wait(done));
+    REQUIRE(id != std::this_thread::get_id());
+}
+
+TEST_CASE("portable_resume_after")
+{
+    auto done = make_event(true);
+    std::chrono::steady_clock::duration elapsed{};
+    after(done, elapsed);
+    REQUIRE(wait(done));
+    REQUIRE(elapsed >= 50ms);
+}
+
+TEST_CASE("portable_resume_on_signal")
+{
+    auto trigger = make_event(false);
+    auto done = make_event(false);
+    bool result = true;
+
+    signal(trigger, done, result, 20ms);
+    REQUIRE(wait(done));
+    REQUIRE(!result);
+
+    signal(trigger, done, result, 5s);
+    WINRT_IMPL_SetEvent(trigger.get());
+    REQUIRE(wait(done));
+    REQUIRE(result);
+
+    // The auto-reset event was consumed by the wait.
+    REQUIRE(WINRT_IMPL_WaitForSingleObject(trigger.get(), 0) == 258);
+}
+
+TEST_CASE("portable_thread_pool")
+{
+    thread_pool pool;
+    pool.thread_limits(4, 1);
+    auto done = make_event(true);
+    std::atomic<uint32_t> count{};
+
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        pooled(pool, done, count);
+    }
+
+    REQUIRE(wait(done));
+}
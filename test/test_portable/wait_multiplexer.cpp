@@ -0,0 +1,218 @@
+#include "pch.h"
+#include <ctime>
+
+using namespace winrt;
+
+#ifndef WINRT_WAIT_MULTIPLEXER
+#error This project must be built with WINRT_WAIT_MULTIPLEXER
+#endif
+
+namespace
+{
+    handle make_event(bool manual_reset)
+    {
+        return handle{ check_pointer(WINRT_IMPL_CreateEventW(nullptr, manual_reset, false, nullptr)) };
+    }
+
+    bool wait(handle const& event)
+    {
+        return WINRT_IMPL_WaitForSingleObject(event.get(), 5000) == 0;
+    }
+
+    fire_and_forget signal(handle const& trigger, handle const& done, std::atomic<uint32_t>& remaining)
+    {
+        co_await resume_on_signal(trigger.get());
+
+        if (--remaining == 0)
+        {
+            WINRT_IMPL_SetEvent(done.get());
+        }
+    }
+
+    fire_and_forget signal(wait_multiplexer& multiplexer, handle const& trigger, handle const& done, std::atomic<uint32_t>& remaining)
+    {
+        co_await multiplexer.resume_on_signal(trigger.get());
+
+        if (--remaining == 0)
+        {
+            WINRT_IMPL_SetEvent(done.get());
+        }
+    }
+}
+
+// resume_on_signal is routed through the shared multiplexer.
+static_assert(std::is_same_v<decltype(resume_on_signal(nullptr)), decltype(impl::get_wait_multiplexer().resume_on_signal(nullptr))>);
+
+TEST_CASE("portable_wait_multiplexer, resume_on_signal")
+{
+    // More waiters than one WaitForMultipleObjects batch can watch.
+    std::vector<handle> triggers;
+    auto done = make_event(true);
+    std::atomic<uint32_t> remaining{ 100 };
+
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        triggers.push_back(make_event(false));
+        signal(triggers.back(), done, remaining);
+    }
+
+    for (auto&& trigger : triggers)
+    {
+        WINRT_IMPL_SetEvent(trigger.get());
+    }
+
+    REQUIRE(wait(done));
+}
+
+TEST_CASE("portable_wait_multiplexer, same handle")
+{
+    wait_multiplexer multiplexer;
+    auto trigger = make_event(true);
+    auto done = make_event(true);
+    std::atomic<uint32_t> remaining{ 2 };
+
+    signal(multiplexer, trigger, done, remaining);
+    signal(multiplexer, trigger, done, remaining);
+
+    // Two waiters on one unsignaled handle must block rather than spin the wait threads.
+    auto const before = std::clock();
+    std::this_thread::sleep_for(200ms);
+    REQUIRE(std::clock() - before < CLOCKS_PER_SEC / 10);
+    REQUIRE(remaining == 2);
+
+    WINRT_IMPL_SetEvent(trigger.get());
+    REQUIRE(wait(done));
+}
+
+#ifdef __linux__
+
+namespace
+{
+    struct descriptor
+    {
+        descriptor() : value(::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK))
+        {
+            REQUIRE(value != -1);
+        }
+
+        descriptor(descriptor&& other) noexcept : value(std::exchange(other.value, -1))
+        {
+        }
+
+        ~descriptor()
+        {
+            if (value != -1)
+            {
+                ::close(value);
+            }
+        }
+
+        void set() const
+        {
+            uint64_t const count{ 1 };
+            REQUIRE(::write(value, &count, sizeof(count)) == sizeof(count));
+        }
+
+        // Called from the wait threads, where REQUIRE can't be used.
+        bool consume() const noexcept
+        {
+            uint64_t count{};
+            return ::read(value, &count, sizeof(count)) == sizeof(count);
+        }
+
+        int value;
+    };
+
+    // Counts down remaining for every wait that either timed out or consumed its signal.
+    fire_and_forget poll_wait(poll_wait_multiplexer& multiplexer, descriptor const& trigger, handle const& done, std::atomic<uint32_t>& remaining, Windows::Foundation::TimeSpan timeout = {})
+    {
+        bool const signaled = co_await multiplexer.resume_on_signal(trigger.value, timeout);
+
+        if (signaled && !trigger.consume())
+        {
+            co_return;
+        }
+
+        if (--remaining == 0)
+        {
+            WINRT_IMPL_SetEvent(done.get());
+        }
+    }
+
+    fire_and_forget poll_cancel(poll_wait_multiplexer& multiplexer, descriptor const& trigger, cancellable_promise& promise, handle const& done, bool& canceled)
+    {
+        // fire_and_forget isn't cancellable, so the test drives the awaiter's cancellation directly.
+        auto awaitable = multiplexer.resume_on_signal(trigger.value);
+        awaitable.set_cancellable_promise(&promise);
+        awaitable.enable_cancellation(&promise);
+
+        try
+        {
+            co_await awaitable;
+        }
+        catch (hresult_canceled const&)
+        {
+            canceled = true;
+        }
+
+        WINRT_IMPL_SetEvent(done.get());
+    }
+}
+
+TEST_CASE("portable_wait_multiplexer, poll")
+{
+    poll_wait_multiplexer multiplexer;
+    auto done = make_event(true);
+
+    // More descriptors than one poll batch holds, so the waiters span several groups.
+    std::vector<descriptor> triggers(300);
+    std::atomic<uint32_t> remaining{ static_cast<uint32_t>(triggers.size()) };
+
+    for (auto&& trigger : triggers)
+    {
+        poll_wait(multiplexer, trigger, done, remaining);
+    }
+
+    for (auto&& trigger : triggers)
+    {
+        trigger.set();
+    }
+
+    REQUIRE(wait(done));
+
+    // Already signaled, so it completes without being registered.
+    auto signaled = make_event(true);
+    remaining = 1;
+    triggers[0].set();
+    poll_wait(multiplexer, triggers[0], signaled, remaining);
+    REQUIRE(wait(signaled));
+}
+
+TEST_CASE("portable_wait_multiplexer, poll timeout")
+{
+    poll_wait_multiplexer multiplexer;
+    descriptor trigger;
+    auto done = make_event(true);
+    std::atomic<uint32_t> remaining{ 1 };
+
+    auto const start = std::chrono::steady_clock::now();
+    poll_wait(multiplexer, trigger, done, remaining, 50ms);
+    REQUIRE(wait(done));
+    REQUIRE(std::chrono::steady_clock::now() - start >= 50ms);
+}
+
+TEST_CASE("portable_wait_multiplexer, poll cancel")
+{
+    poll_wait_multiplexer multiplexer;
+    descriptor trigger;
+    auto done = make_event(true);
+    cancellable_promise promise;
+    bool canceled{};
+
+    poll_cancel(multiplexer, trigger, promise, done, canceled);
+    promise.cancel();
+    REQUIRE(wait(done));
+    REQUIRE(canceled);
+}
+
+#endif